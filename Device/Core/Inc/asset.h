@@ -0,0 +1,44 @@
+#ifndef __ASSET_H__
+#define __ASSET_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gfx.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Constants -----------------------------------------------------------------------------------------------------------
+
+#define ASSET_MAX_COUNT 64           // Asset IDs are 0 to ASSET_MAX_COUNT - 1
+#define ASSET_POOL_SIZE (768 * 1024) // SDRAM shared by all assets
+
+// Types ---------------------------------------------------------------------------------------------------------------
+
+// Images uploaded once by ID into SDRAM and drawn into the back buffer by DMA2D as often as needed. RGB565 assets are
+// copied, the others (ARGB8888, ARGB4444, A8, A4) are blended over what is already there. Uploading an ID again
+// replaces its image, reusing its space when the new one fits, and asset_clear() frees the whole pool.
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    gfx_format_t format;
+    const uint8_t *data;
+} asset_t;
+
+// API -----------------------------------------------------------------------------------------------------------------
+
+size_t asset_data_size(uint16_t width, uint16_t height, gfx_format_t format);
+uint8_t *asset_begin_upload(uint32_t id, uint16_t width, uint16_t height, gfx_format_t format);
+void asset_commit_upload(void);
+const asset_t *asset_get(uint32_t id);
+bool asset_draw(uint32_t id, uint16_t x, uint16_t y, uint32_t color);
+void asset_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ASSET_H__
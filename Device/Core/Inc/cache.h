@@ -0,0 +1,38 @@
+#ifndef __CACHE_H__
+#define __CACHE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Constants -----------------------------------------------------------------------------------------------------------
+
+#define CACHE_LINE_SIZE 32 // Cortex-M7 D-cache line, maintenance works on whole lines
+#define CACHE_SDRAM_BASE 0xC0000000
+#define CACHE_SDRAM_SIZE (8 * 1024 * 1024)
+
+// Types ---------------------------------------------------------------------------------------------------------------
+
+// Cortex-M7 caches and the MPU map they depend on. Flash and the SDRAM holding the framebuffers, slots, assets and
+// message buffer are write-through, so every CPU write reaches memory and LTDC and DMA2D see it without a clean. SRAM1
+// and SRAM2 are write-back, and DTCM, which holds the UART buffers, is never cached. The unpopulated external memory
+// windows around the SDRAM are left inaccessible, which keeps the core from speculatively reading them.
+//
+// DMA and DMA2D read memory rather than the cache, so a buffer the CPU wrote is cleaned before a transfer reads it,
+// and one a transfer wrote is invalidated before the CPU reads it. Both round out to whole lines and skip memory that
+// cannot hold the lines they would act on.
+
+// API -----------------------------------------------------------------------------------------------------------------
+
+void cache_init(void); // Before HAL_Init(), nothing may be cached while the MPU map changes
+void cache_clean(const void *address, size_t size);
+void cache_invalidate(const void *address, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __CACHE_H__
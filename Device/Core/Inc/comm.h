@@ -10,21 +10,33 @@ extern "C" {
 
 // Constants -----------------------------------------------------------------------------------------------------------
 
-#define CBOR_BUFFER_SIZE (IMAGE_DATA_SIZE + 256) // Add 256 bytes for length prefix and other overhead
+#define CBOR_BUFFER_SIZE 16384 // Buffered messages only, display_image payloads stream into the framebuffer
+
+#define IMAGE_MESSAGE_MAX_SIZE (IMAGE_DATA_SIZE + 256) // Add 256 bytes for the RPC header around image_data
+#define MESSAGE_DISCARD_MAX_SIZE (4 * IMAGE_MESSAGE_MAX_SIZE) // Longer length prefixes are taken to be corrupt
+
+#define USART6_RESYNC_IDLE_MS 100 // A message still incomplete this long after the line went quiet is dropped
+
+#define IMAGE_CHUNK_BLOCK_SIZE 512 // image_chunk offsets and lengths are multiples of this, tracked with one bit each
+
+#define STREAM_MAX_CREDITS 4      // Stream frames in flight, each one is acknowledged through a response slot
+#define STREAM_FPS_WINDOW_MS 1000 // Achieved frame rate is measured over this long
 
 #define USART1_RX_BUFFER_SIZE 256
 #define USART1_TX_BUFFER_SIZE 256
 
-#define USART6_RX_BUFFER_SIZE CBOR_BUFFER_SIZE
-#define USART6_TX_BUFFER_SIZE 256
+#define USART6_RX_BUFFER_SIZE 32768 // Circular DMA ring, must fit the 16-bit DMA transfer counter
+#define USART6_TX_BUFFER_SIZE 516 // One response slot: 4-byte length prefix plus CBOR body
+#define USART6_TX_QUEUE_LENGTH 4  // Preallocated response slots drained by DMA
 
 // API -----------------------------------------------------------------------------------------------------------------
 
 void USART1_Send_String(const char *str);
 
-void USART6_Start_Receive_IT(void);
+void USART6_Start_Receive_DMA(void);
 uint32_t USART6_Available(void);
 uint8_t USART6_Read_Byte(void);
+uint32_t USART6_Read(uint8_t *dest, uint32_t max_length);
 void USART6_Send_String(const char *str);
 void USART6_Process_Message(void);
 
@@ -0,0 +1,678 @@
+// Generated automatically - do not edit
+// DejaVuSansMono.ttf at 16 px, A4, 950x19 atlas
+
+static const uint8_t font_mono16_atlas[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x02, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x33,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x13, 0x00,
+    0x00, 0x00, 0x20, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x93, 0x30, 0x09, 0x00,
+    0x00, 0x00, 0x16, 0x50, 0x02, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0xA1, 0xCC, 0x08, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x08, 0x00, 0x00, 0xE0,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92,
+    0x02, 0x00, 0xA1, 0xCC, 0x07, 0x00, 0x00, 0x73, 0x99, 0x01, 0x00, 0x30, 0xC8, 0xCC, 0x06, 0x00,
+    0x30, 0xCA, 0xCC, 0x07, 0x00, 0x00, 0x00, 0x70, 0x39, 0x00, 0x30, 0x99, 0x99, 0x59, 0x00, 0x00,
+    0x70, 0xCC, 0x7C, 0x00, 0x90, 0x99, 0x99, 0x99, 0x03, 0x00, 0xB3, 0xCC, 0x19, 0x00, 0x00, 0xB5,
+    0xCC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xCC, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x89, 0x00, 0x00, 0x70, 0x99, 0x99, 0x06, 0x00,
+    0x00, 0x50, 0xCB, 0x9C, 0x01, 0x90, 0x99, 0x59, 0x00, 0x00, 0x30, 0x99, 0x99, 0x99, 0x03, 0x10,
+    0x99, 0x99, 0x99, 0x05, 0x00, 0x70, 0xCC, 0x7C, 0x00, 0x90, 0x05, 0x00, 0x90, 0x05, 0x30, 0x99,
+    0x99, 0x99, 0x00, 0x00, 0x90, 0x99, 0x39, 0x00, 0x90, 0x05, 0x00, 0x70, 0x09, 0x30, 0x19, 0x00,
+    0x00, 0x00, 0x93, 0x08, 0x00, 0x92, 0x09, 0x90, 0x29, 0x00, 0x90, 0x05, 0x00, 0xA1, 0xCC, 0x07,
+    0x00, 0x30, 0x99, 0x99, 0x17, 0x00, 0x00, 0xA1, 0xCC, 0x07, 0x00, 0x70, 0x99, 0x89, 0x03, 0x00,
+    0x00, 0xA3, 0xCC, 0x6A, 0x00, 0x95, 0x99, 0x99, 0x99, 0x19, 0x70, 0x07, 0x00, 0x91, 0x03, 0x94,
+    0x01, 0x00, 0x50, 0x09, 0x59, 0x00, 0x00, 0x00, 0x59, 0x91, 0x05, 0x00, 0x60, 0x08, 0x94, 0x01,
+    0x00, 0x50, 0x19, 0x50, 0x99, 0x99, 0x99, 0x09, 0x00, 0x60, 0xFF, 0x0F, 0x00, 0x90, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x10, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9C, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x30, 0x6F, 0x00, 0x00, 0x00, 0xA0, 0xEC, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x6C,
+    0x00, 0x00, 0x30, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0xF6, 0x60, 0x0F, 0x00, 0x00, 0x20, 0x1F, 0xF0, 0x04,
+    0x00, 0x10, 0x88, 0x03, 0x00, 0xD1, 0xFE, 0x06, 0x00, 0x00, 0x00, 0xCE, 0x66, 0x08, 0x00, 0x00,
+    0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x01, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x00, 0x20, 0x01,
+    0x39, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0xED, 0x87, 0x8F,
+    0x00, 0x00, 0xFF, 0xFE, 0x03, 0x00, 0xC0, 0x8E, 0xB6, 0x8F, 0x00, 0x90, 0x8B, 0xA6, 0x8F, 0x00,
+    0x00, 0x00, 0xF4, 0x6F, 0x00, 0x60, 0x9F, 0x99, 0x59, 0x00, 0x00, 0xFA, 0x6A, 0xB8, 0x00, 0x90,
+    0x99, 0x99, 0xFC, 0x03, 0x30, 0xCF, 0x76, 0xDE, 0x00, 0x50, 0xAF, 0x86, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x86, 0xBF, 0x00, 0x00, 0x70, 0xCC, 0x7C,
+    0x00, 0x00, 0x70, 0xFF, 0x01, 0x00, 0xC0, 0x9E, 0xA9, 0xCF, 0x00, 0x00, 0xF6, 0x6B, 0xD7, 0x06,
+    0xF0, 0x9D, 0xFB, 0x3E, 0x00, 0x60, 0xAF, 0x99, 0x99, 0x03, 0x30, 0xCF, 0x99, 0x99, 0x05, 0x00,
+    0xFC, 0x69, 0xE8, 0x03, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0x30, 0x99, 0xDF, 0x99, 0x00, 0x00, 0x90,
+    0xA9, 0x6F, 0x00, 0xF0, 0x09, 0x00, 0xF9, 0x06, 0x60, 0x3F, 0x00, 0x00, 0x00, 0xF6, 0x3F, 0x00,
+    0xF9, 0x0F, 0xF0, 0x8F, 0x00, 0xF0, 0x09, 0x10, 0xEE, 0x87, 0xAF, 0x00, 0x60, 0xAF, 0xA9, 0xFF,
+    0x03, 0x10, 0xEE, 0x87, 0xAF, 0x00, 0xC0, 0x9E, 0xE9, 0x8F, 0x00, 0x30, 0xCF, 0x67, 0xFA, 0x00,
+    0x95, 0x99, 0xDF, 0x99, 0x19, 0xC0, 0x0C, 0x00, 0xF3, 0x06, 0xF3, 0x05, 0x00, 0xC0, 0x0E, 0xAC,
+    0x00, 0x00, 0x00, 0x7F, 0x90, 0x1F, 0x00, 0xF2, 0x07, 0xF1, 0x0A, 0x00, 0xE1, 0x0A, 0x50, 0x99,
+    0x99, 0xF9, 0x0E, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xA0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0x00, 0x00, 0x00, 0xC0, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00,
+    0x93, 0x01, 0x00, 0x30, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x30, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x00, 0xF6, 0x60, 0x0F, 0x00, 0x00, 0x70, 0x0D, 0xF3, 0x00, 0x00, 0xF8, 0xEE, 0xFE, 0x00,
+    0xA9, 0x10, 0x1F, 0x00, 0x00, 0x30, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00,
+    0x00, 0xAB, 0x00, 0x00, 0x00, 0x10, 0x5F, 0x00, 0x00, 0x40, 0x7D, 0x59, 0xBA, 0x01, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x7F, 0x00, 0x60, 0x3F, 0x00, 0xF8, 0x01, 0x00, 0x03, 0xF6, 0x03,
+    0x00, 0x30, 0x00, 0x00, 0xFA, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x8D, 0x6F, 0x00,
+    0x60, 0x0F, 0x00, 0x00, 0x00, 0x40, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x90,
+    0x0F, 0x00, 0xF5, 0x04, 0xC0, 0x0D, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xF8, 0x01, 0x10, 0xCD, 0x35, 0xE6, 0x08, 0x00, 0xC0, 0xF9, 0x07,
+    0x00, 0xC0, 0x0C, 0x00, 0xF5, 0x05, 0x20, 0xAF, 0x00, 0x00, 0x01, 0xF0, 0x09, 0x10, 0xDE, 0x00,
+    0x60, 0x3F, 0x00, 0x00, 0x00, 0x30, 0x6F, 0x00, 0x00, 0x00, 0x70, 0x4F, 0x00, 0x10, 0x01, 0xF0,
+    0x09, 0x00, 0xF0, 0x09, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x30, 0x6F, 0x00, 0xF0, 0x09,
+    0x60, 0x6F, 0x00, 0x60, 0x3F, 0x00, 0x00, 0x00, 0xF6, 0x8C, 0x00, 0xCE, 0x0F, 0xF0, 0xEE, 0x00,
+    0xF0, 0x09, 0x80, 0x1F, 0x00, 0xF8, 0x03, 0x60, 0x3F, 0x00, 0xF1, 0x0B, 0x80, 0x1F, 0x00, 0xF8,
+    0x03, 0xC0, 0x0C, 0x00, 0xFA, 0x01, 0xC0, 0x0C, 0x00, 0x10, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0xC0, 0x0C, 0x00, 0xF3, 0x06, 0xE0, 0x0A, 0x00, 0xF0, 0x08, 0xCA, 0x00, 0x00, 0x30, 0x5F, 0x10,
+    0xAE, 0x00, 0xDC, 0x00, 0x70, 0x2F, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xF6, 0x05, 0x00, 0x60,
+    0x0F, 0x00, 0x00, 0x20, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0xEA, 0x61,
+    0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9C, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0xF6, 0x60, 0x0F,
+    0x00, 0x30, 0xB3, 0x3A, 0xD8, 0x13, 0x50, 0x3F, 0x66, 0x40, 0x00, 0x6C, 0x00, 0x3D, 0x00, 0x00,
+    0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x10, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0xBB, 0x00, 0x00, 0x00, 0x70, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x0E, 0x00, 0xB0, 0x0E, 0x00, 0xF3, 0x05, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0x03, 0x00, 0x00, 0x00, 0xF6, 0x02, 0x00, 0x80, 0x3B, 0x6F, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00,
+    0xA0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7F, 0x00, 0xA0, 0x0D, 0x00, 0xF3, 0x05, 0xF0,
+    0x09, 0x00, 0xF3, 0x05, 0x00, 0x10, 0x56, 0x00, 0x00, 0x00, 0x10, 0x56, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0xB0, 0x0A, 0x00, 0x30, 0x0F, 0x00, 0xF1, 0xA5, 0x0B, 0x00, 0xC0, 0x0C, 0x00, 0xF3,
+    0x06, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x09, 0x00, 0xF5, 0x04, 0x60, 0x3F, 0x00, 0x00, 0x00,
+    0x30, 0x6F, 0x00, 0x00, 0x00, 0xE0, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x30, 0x6F, 0x00, 0xF0, 0x09, 0xF6, 0x06, 0x00, 0x60, 0x3F,
+    0x00, 0x00, 0x00, 0xF6, 0xE7, 0x40, 0x9E, 0x0F, 0xF0, 0xEA, 0x06, 0xF0, 0x09, 0xD0, 0x0C, 0x00,
+    0xF2, 0x07, 0x60, 0x3F, 0x00, 0xC0, 0x0E, 0xD0, 0x0C, 0x00, 0xF2, 0x07, 0xC0, 0x0C, 0x00, 0xF6,
+    0x05, 0xE0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0xF3, 0x06,
+    0xA0, 0x0E, 0x00, 0xF4, 0x04, 0xE8, 0x00, 0x46, 0x40, 0x3F, 0x00, 0xF6, 0x53, 0x3F, 0x00, 0x00,
+    0xBD, 0x10, 0x8F, 0x00, 0x00, 0x00, 0x10, 0xAF, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00, 0xCC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x70, 0x1E, 0x00, 0xF6, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xDA, 0xEF, 0x1A, 0x00, 0x60, 0x5F, 0xFE, 0x1B,
+    0x00, 0x00, 0x60, 0xFC, 0xAE, 0x01, 0x00, 0xD5, 0xBF, 0xF5, 0x03, 0x00, 0xA2, 0xFE, 0x1B, 0x00,
+    0x50, 0xDC, 0xDF, 0xCC, 0x05, 0x00, 0xE5, 0xBF, 0xC4, 0x02, 0x60, 0x3F, 0xFC, 0x3C, 0x00, 0x00,
+    0xCC, 0x7C, 0x00, 0x00, 0x00, 0xCA, 0xCC, 0x02, 0x00, 0x30, 0x6F, 0x00, 0xC3, 0x06, 0x00, 0x60,
+    0x0F, 0x00, 0x00, 0xC2, 0xF8, 0x4B, 0xEE, 0x03, 0x50, 0x3C, 0xFC, 0x3C, 0x00, 0x00, 0xB3, 0xEF,
+    0x0A, 0x00, 0x70, 0x5C, 0xFE, 0x1B, 0x00, 0x00, 0xC3, 0xBF, 0xC4, 0x02, 0x00, 0xC2, 0x82, 0xFE,
+    0x0A, 0x00, 0xB3, 0xFF, 0x5C, 0x00, 0xC0, 0xEC, 0xCF, 0xCC, 0x00, 0x50, 0x0C, 0x00, 0xC2, 0x02,
+    0xC1, 0x04, 0x00, 0x90, 0x08, 0x6B, 0x00, 0x00, 0x00, 0x7A, 0xA0, 0x09, 0x00, 0xC1, 0x05, 0xC0,
+    0x06, 0x00, 0x80, 0x0B, 0x20, 0xCC, 0xCC, 0xCC, 0x02, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x00,
+    0x6C, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x93, 0x30, 0x09, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x9F, 0x80, 0x0F, 0x66, 0x00, 0x00, 0xD7, 0x74, 0x0E, 0x10, 0x07, 0x00, 0xE9, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x50, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00,
+    0xC5, 0xBD, 0x2B, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0xD0, 0x0B, 0x00,
+    0xF0, 0x08, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x10, 0xDC,
+    0x00, 0x00, 0xF2, 0x32, 0x6F, 0x00, 0x60, 0x8F, 0x8B, 0x03, 0x00, 0xC0, 0x39, 0xAA, 0x07, 0x00,
+    0x00, 0x00, 0x70, 0x1F, 0x00, 0x50, 0x3F, 0x00, 0xEA, 0x01, 0xF0, 0x09, 0x00, 0xF3, 0x06, 0x00,
+    0x30, 0xCF, 0x00, 0x00, 0x00, 0x30, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x82, 0xFE, 0x0A, 0x31, 0x33,
+    0x33, 0x33, 0x03, 0xC3, 0xCF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x60, 0x8F, 0x00, 0xF3, 0x01, 0x81,
+    0x38, 0x3F, 0x00, 0xF6, 0x70, 0x1F, 0x00, 0xC0, 0x0C, 0x00, 0xF8, 0x03, 0xC0, 0x0D, 0x00, 0x00,
+    0x00, 0xF0, 0x09, 0x00, 0xF2, 0x08, 0x60, 0x3F, 0x00, 0x00, 0x00, 0x30, 0x6F, 0x00, 0x00, 0x00,
+    0xF1, 0x09, 0x00, 0x00, 0x00, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x6F, 0x00, 0xF0, 0x69, 0x6F, 0x00, 0x00, 0x60, 0x3F, 0x00, 0x00, 0x00, 0xF6, 0xE3,
+    0x93, 0x98, 0x0F, 0xF0, 0x89, 0x0C, 0xF0, 0x09, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0x60, 0x3F, 0x00,
+    0xD0, 0x0D, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0xC0, 0x0C, 0x00, 0xF7, 0x03, 0xC0, 0x2E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0xF3, 0x06, 0x50, 0x2F, 0x00, 0xF8, 0x00,
+    0xF6, 0x30, 0xDF, 0x60, 0x0F, 0x00, 0xC0, 0xEC, 0x09, 0x00, 0x00, 0xF4, 0xA3, 0x0E, 0x00, 0x00,
+    0x00, 0xA0, 0x1E, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x00, 0x00, 0x91, 0x03, 0x00, 0x50, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x6A, 0x53, 0xDE, 0x00, 0x60, 0xDF, 0x55, 0xEE, 0x00, 0x00, 0xF8, 0x48, 0xA5,
+    0x03, 0x40, 0xAF, 0x83, 0xFE, 0x03, 0x10, 0xCF, 0x45, 0xEC, 0x00, 0x20, 0x86, 0x8F, 0x66, 0x02,
+    0x40, 0xAF, 0x83, 0xFE, 0x03, 0x60, 0xCF, 0x56, 0xDE, 0x00, 0x00, 0x66, 0x9E, 0x00, 0x00, 0x00,
+    0x65, 0xFA, 0x03, 0x00, 0x30, 0x6F, 0x30, 0x9F, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xF3, 0x5A,
+    0xCF, 0xC3, 0x0A, 0x60, 0xCF, 0x56, 0xDE, 0x00, 0x20, 0xCF, 0x64, 0xCE, 0x00, 0x90, 0xEF, 0x55,
+    0xEE, 0x00, 0x20, 0xAF, 0x85, 0xFF, 0x03, 0x00, 0xF3, 0xCB, 0x66, 0x0C, 0x10, 0xBF, 0x34, 0x77,
+    0x00, 0x60, 0xC6, 0x6E, 0x66, 0x00, 0x60, 0x0F, 0x00, 0xF3, 0x03, 0xC0, 0x0B, 0x00, 0xF1, 0x06,
+    0xAB, 0x00, 0x00, 0x10, 0x5F, 0x30, 0x7F, 0x00, 0xCC, 0x00, 0xA0, 0x0C, 0x00, 0xF0, 0x08, 0x10,
+    0x66, 0x66, 0xFC, 0x01, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x01, 0x4F, 0x00, 0x50, 0x7F, 0x67, 0x00,
+    0x00, 0x70, 0xAC, 0x52, 0xCB, 0x05, 0x30, 0xEF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x03, 0x00, 0x80, 0x19, 0x39, 0xD3, 0x02, 0x00,
+    0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x01, 0x00, 0xF0, 0x19, 0x8D, 0xF0, 0x09, 0x00, 0x00, 0xF6,
+    0x03, 0x00, 0x00, 0x00, 0x20, 0x8F, 0x00, 0x00, 0xC0, 0xFE, 0x1A, 0x00, 0x00, 0x8C, 0x30, 0x6F,
+    0x00, 0x60, 0x9D, 0xEA, 0x6F, 0x00, 0xF0, 0xFC, 0xA9, 0xCF, 0x00, 0x00, 0x00, 0xD0, 0x0B, 0x00,
+    0x00, 0xF5, 0xEC, 0x2D, 0x00, 0xD0, 0x0C, 0x00, 0xF7, 0x09, 0x00, 0x30, 0xCF, 0x00, 0x00, 0x00,
+    0x30, 0xCF, 0x00, 0x00, 0x00, 0xC6, 0xCF, 0x16, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x82,
+    0xFE, 0x3A, 0x00, 0x00, 0x00, 0xF5, 0x09, 0x00, 0xA8, 0x10, 0xBF, 0xE9, 0x3F, 0x00, 0xCB, 0x10,
+    0x5F, 0x00, 0xC0, 0xCF, 0xEC, 0x5F, 0x00, 0xE0, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0x09, 0x00, 0xF0,
+    0x09, 0x60, 0xDF, 0xCC, 0xCC, 0x02, 0x30, 0xEF, 0xCC, 0xCC, 0x02, 0xF3, 0x06, 0x00, 0x00, 0x00,
+    0xF0, 0xCE, 0xCC, 0xFC, 0x09, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x30, 0x6F, 0x00, 0xF0,
+    0xFE, 0x3F, 0x00, 0x00, 0x60, 0x3F, 0x00, 0x00, 0x00, 0xF6, 0x93, 0xE8, 0x93, 0x0F, 0xF0, 0x19,
+    0x3F, 0xF0, 0x09, 0xF0, 0x09, 0x00, 0xF0, 0x0B, 0x60, 0x3F, 0x00, 0xF7, 0x08, 0xF0, 0x09, 0x00,
+    0xF0, 0x0B, 0xC0, 0x3D, 0x63, 0xCF, 0x00, 0x30, 0xFF, 0xAD, 0x04, 0x00, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0xC0, 0x0C, 0x00, 0xF3, 0x06, 0x10, 0x7F, 0x00, 0xAD, 0x00, 0xF3, 0x73, 0xFC, 0x80, 0x0D,
+    0x00, 0x20, 0xEF, 0x00, 0x00, 0x00, 0xB0, 0xFE, 0x05, 0x00, 0x00, 0x00, 0xF5, 0x05, 0x00, 0x00,
+    0x60, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x03, 0x60, 0x4F, 0x00, 0xF2, 0x06, 0x10, 0x8F, 0x00, 0x00, 0x00, 0xB0, 0x0D, 0x00, 0xFA,
+    0x03, 0xA0, 0x0E, 0x00, 0xF0, 0x06, 0x00, 0x30, 0x3F, 0x00, 0x00, 0xB0, 0x0D, 0x00, 0xFA, 0x03,
+    0x60, 0x3F, 0x00, 0xF5, 0x02, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x30,
+    0x6F, 0xF3, 0x08, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xF3, 0x03, 0x9D, 0x70, 0x0C, 0x60, 0x3F,
+    0x00, 0xF5, 0x02, 0x90, 0x0E, 0x00, 0xF5, 0x04, 0x90, 0x4F, 0x00, 0xF3, 0x05, 0x90, 0x0E, 0x00,
+    0xF8, 0x03, 0x00, 0xF3, 0x0C, 0x00, 0x00, 0x30, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0C, 0x00,
+    0x00, 0x60, 0x0F, 0x00, 0xF3, 0x03, 0x60, 0x1F, 0x00, 0xF6, 0x01, 0xE7, 0x00, 0x12, 0x40, 0x1F,
+    0x00, 0xF7, 0x82, 0x1F, 0x00, 0x50, 0x3F, 0x00, 0xF5, 0x01, 0x00, 0x00, 0x40, 0x5F, 0x00, 0x00,
+    0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE5, 0x30, 0x0F, 0x00, 0x00, 0xF8, 0xEF, 0x29, 0x00, 0x00, 0x81, 0x8D, 0x02,
+    0x00, 0xE0, 0x37, 0x7F, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x93, 0x99, 0xCE, 0x99, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8E, 0x00, 0x00, 0xF0, 0x19, 0xBF, 0xF0, 0x09, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x00, 0x00, 0xE1,
+    0x0C, 0x00, 0x00, 0x60, 0xA6, 0x7F, 0x00, 0x60, 0x0E, 0x30, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0x01, 0xF0, 0x3F, 0x00, 0xF5, 0x05, 0x00, 0x00, 0xF3, 0x05, 0x00, 0x10, 0xCD, 0x87, 0x8F, 0x00,
+    0x70, 0x7F, 0x53, 0xFE, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0x8E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFA, 0x0D, 0x00, 0x00,
+    0xAE, 0x00, 0x00, 0x7B, 0x90, 0x0B, 0x20, 0x3F, 0x00, 0x7F, 0x00, 0xAE, 0x00, 0xC0, 0x6E, 0x76,
+    0xDD, 0x01, 0xE0, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0x60, 0x8F, 0x66, 0x66,
+    0x01, 0x30, 0xAF, 0x66, 0x66, 0x01, 0xF3, 0x06, 0x90, 0xFF, 0x09, 0xF0, 0x6C, 0x66, 0xF6, 0x09,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x30, 0x6F, 0x00, 0xF0, 0x9F, 0xDE, 0x00, 0x00, 0x60,
+    0x3F, 0x00, 0x00, 0x00, 0xF6, 0x43, 0xEF, 0x90, 0x0F, 0xF0, 0x09, 0x9B, 0xF0, 0x09, 0xF0, 0x09,
+    0x00, 0xF0, 0x0C, 0x60, 0xFF, 0xFF, 0xBF, 0x00, 0xF0, 0x09, 0x00, 0xF0, 0x0C, 0xC0, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x71, 0xFB, 0xBF, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0xF3,
+    0x06, 0x00, 0xBB, 0x10, 0x6F, 0x00, 0xF1, 0xA3, 0xE7, 0x94, 0x0B, 0x00, 0x60, 0xFF, 0x02, 0x00,
+    0x00, 0x20, 0xCF, 0x00, 0x00, 0x00, 0x10, 0xAE, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00,
+    0x50, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x98, 0xFA, 0x03, 0x60, 0x0F, 0x00,
+    0xE0, 0x09, 0x60, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0x09, 0x00, 0xF6, 0x03, 0xF0, 0x3A, 0x33, 0xD3,
+    0x09, 0x00, 0x30, 0x3F, 0x00, 0x00, 0xF0, 0x09, 0x00, 0xF6, 0x03, 0x60, 0x0F, 0x00, 0xF3, 0x03,
+    0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x30, 0xAF, 0x9F, 0x00, 0x00, 0x00,
+    0x60, 0x0F, 0x00, 0x00, 0xF3, 0x03, 0x9C, 0x60, 0x0C, 0x60, 0x0F, 0x00, 0xF3, 0x03, 0xC0, 0x0A,
+    0x00, 0xF0, 0x07, 0x90, 0x0F, 0x00, 0xF0, 0x09, 0xC0, 0x0A, 0x00, 0xF4, 0x03, 0x00, 0xF3, 0x06,
+    0x00, 0x00, 0x10, 0xAF, 0x03, 0x00, 0x00, 0x00, 0x90, 0x0C, 0x00, 0x00, 0x60, 0x0F, 0x00, 0xF3,
+    0x03, 0x10, 0x6F, 0x00, 0xAC, 0x00, 0xF3, 0x01, 0xAF, 0x70, 0x0E, 0x00, 0xA0, 0xFE, 0x05, 0x00,
+    0x00, 0x8E, 0x00, 0xCB, 0x00, 0x00, 0x00, 0xF1, 0x08, 0x00, 0x10, 0xA6, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x67, 0x00, 0xA1, 0xFF, 0x6C, 0x43, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xCC, 0xA6,
+    0x6E, 0x05, 0x00, 0x10, 0xB8, 0xFD, 0x03, 0xB1, 0x5C, 0x80, 0xEF, 0x05, 0xE6, 0x00, 0xF7, 0x03,
+    0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x03, 0x00,
+    0x00, 0x00, 0x13, 0x00, 0x00, 0x93, 0x99, 0xCE, 0x99, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x1F, 0x00, 0x00, 0xE0, 0x0A,
+    0x01, 0xF0, 0x08, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0x03, 0xF1, 0x05, 0x30, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x04, 0xE0, 0x0D, 0x00, 0xF0,
+    0x08, 0x00, 0x00, 0xEA, 0x00, 0x00, 0xB0, 0x0E, 0x00, 0xF4, 0x05, 0x00, 0xE8, 0xEF, 0xF3, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x8E, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFA, 0x0C, 0x00, 0x30, 0x6F, 0x00, 0x00, 0x6C, 0xC0,
+    0x06, 0x00, 0x3E, 0x50, 0x8F, 0x66, 0xFC, 0x00, 0xC0, 0x0C, 0x00, 0xE0, 0x0A, 0xC0, 0x0C, 0x00,
+    0x00, 0x00, 0xF0, 0x09, 0x00, 0xF1, 0x09, 0x60, 0x3F, 0x00, 0x00, 0x00, 0x30, 0x6F, 0x00, 0x00,
+    0x00, 0xF1, 0x08, 0x30, 0xE6, 0x09, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x6F, 0x00, 0xF0, 0x0B, 0xF4, 0x08, 0x00, 0x60, 0x3F, 0x00, 0x00, 0x00, 0xF6,
+    0x03, 0x7C, 0x90, 0x0F, 0xF0, 0x09, 0xF4, 0xF1, 0x09, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0x60, 0x8F,
+    0x46, 0x01, 0x00, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0xC0, 0x0C, 0x81, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x05, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0xF3, 0x06, 0x00, 0xF7, 0x50, 0x1F,
+    0x00, 0xF0, 0xD6, 0xA4, 0xC7, 0x09, 0x00, 0xE1, 0xC9, 0x0C, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0xA0, 0x1E, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xEF, 0x99, 0xFA, 0x03, 0x60, 0x0F, 0x00, 0xC0, 0x09, 0x60, 0x0F, 0x00,
+    0x00, 0x00, 0xF0, 0x06, 0x00, 0xF5, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x30, 0x3F, 0x00,
+    0x00, 0xF0, 0x06, 0x00, 0xF5, 0x03, 0x60, 0x0F, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x9C, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0x03, 0x00, 0x30, 0xFF, 0xFC, 0x02, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xF3,
+    0x03, 0x9C, 0x60, 0x0C, 0x60, 0x0F, 0x00, 0xF3, 0x03, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0x90, 0x0F,
+    0x00, 0xC0, 0x09, 0xF0, 0x09, 0x00, 0xF3, 0x03, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x00, 0xE5, 0xFF,
+    0x3B, 0x00, 0x00, 0x90, 0x0C, 0x00, 0x00, 0x60, 0x0F, 0x00, 0xF3, 0x03, 0x00, 0xBB, 0x10, 0x5F,
+    0x00, 0xF0, 0x45, 0xED, 0xB0, 0x0A, 0x00, 0x20, 0xCF, 0x00, 0x00, 0x00, 0xE8, 0x10, 0x5F, 0x00,
+    0x00, 0x00, 0xCD, 0x00, 0x00, 0x20, 0xFC, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00,
+    0x00, 0xE3, 0xCE, 0x00, 0x96, 0x33, 0xE8, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xDF, 0xFC, 0xCE, 0x0A, 0x00, 0x00, 0x66,
+    0xE0, 0x09, 0x20, 0x00, 0xC6, 0x41, 0x1F, 0xC9, 0x00, 0xB0, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x0A, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0xF3, 0x06, 0x00, 0x00,
+    0xF6, 0x03, 0x00, 0x00, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x06, 0xF3, 0xFF, 0xFF,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF3, 0x06, 0xC0, 0x0C, 0x00, 0xF0, 0x09, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0x00, 0x00, 0x00, 0xF1, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xCF, 0x17, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
+    0x93, 0xFE, 0x39, 0x00, 0x00, 0x20, 0x5C, 0x00, 0x00, 0x6C, 0xB0, 0x08, 0x00, 0x3F, 0xA0, 0xFF,
+    0xFF, 0xFF, 0x04, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0xA0, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x09, 0x00,
+    0xF4, 0x05, 0x60, 0x3F, 0x00, 0x00, 0x00, 0x30, 0x6F, 0x00, 0x00, 0x00, 0xF0, 0x0A, 0x00, 0xC0,
+    0x09, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x30, 0x6F, 0x00,
+    0xF0, 0x09, 0x90, 0x3F, 0x00, 0x60, 0x3F, 0x00, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x90, 0x0F, 0xF0,
+    0x09, 0xE0, 0xF7, 0x09, 0xE0, 0x0B, 0x00, 0xF1, 0x08, 0x60, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0x0B,
+    0x00, 0xF1, 0x08, 0xC0, 0x0C, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x09, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0xC0, 0x0C, 0x00, 0xF3, 0x06, 0x00, 0xF2, 0xA3, 0x0C, 0x00, 0xC0, 0xF9, 0x60, 0xDA,
+    0x06, 0x00, 0xEA, 0x31, 0x5F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0xF4, 0x05, 0x00, 0x00,
+    0x00, 0x60, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x01, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0B,
+    0x00, 0xF3, 0x03, 0x60, 0x0F, 0x00, 0xD0, 0x09, 0x60, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x08, 0x00,
+    0xF6, 0x03, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3F, 0x00, 0x00, 0xF0, 0x08, 0x00, 0xF6,
+    0x03, 0x60, 0x0F, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x03, 0x00,
+    0x30, 0x8F, 0xD0, 0x0C, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xF3, 0x03, 0x9C, 0x60, 0x0C, 0x60,
+    0x0F, 0x00, 0xF3, 0x03, 0xE0, 0x09, 0x00, 0xF0, 0x08, 0x90, 0x0F, 0x00, 0xE0, 0x09, 0xE0, 0x09,
+    0x00, 0xF3, 0x03, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x61, 0xDE, 0x00, 0x00, 0x90, 0x0C,
+    0x00, 0x00, 0x60, 0x0F, 0x00, 0xF3, 0x03, 0x00, 0xF5, 0x71, 0x0F, 0x00, 0xC0, 0x88, 0xC7, 0xE2,
+    0x06, 0x00, 0xC0, 0xFD, 0x07, 0x00, 0x00, 0xF1, 0x75, 0x0E, 0x00, 0x00, 0xA0, 0x1E, 0x00, 0x00,
+    0x00, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x1F, 0xF0, 0x04, 0x00, 0x00, 0x00, 0x66, 0xD0, 0x0A, 0x00, 0x00, 0x69,
+    0x00, 0x6C, 0xF7, 0x01, 0x10, 0xFE, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00,
+    0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x56, 0x00, 0x00, 0x00,
+    0xF5, 0x02, 0x00, 0x00, 0x80, 0x1F, 0x00, 0xF6, 0x02, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x00, 0xEB,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x05, 0x30, 0x33, 0x53, 0x8F, 0x02, 0x00, 0x00, 0x00,
+    0xF7, 0x02, 0x80, 0x0E, 0x00, 0xF1, 0x07, 0x00, 0x60, 0x3F, 0x00, 0x00, 0xE0, 0x0B, 0x00, 0xF1,
+    0x08, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x10, 0x56, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xFE, 0x0A, 0x31, 0x33, 0x33, 0x33, 0x03, 0xD3, 0xCF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8A, 0x50, 0x3E, 0x90, 0x3F, 0xE0, 0x0A, 0x00, 0xF0, 0x09, 0xC0, 0x0C,
+    0x00, 0xD0, 0x0C, 0x50, 0x5F, 0x00, 0x00, 0x00, 0xF0, 0x09, 0x00, 0xFA, 0x01, 0x60, 0x3F, 0x00,
+    0x00, 0x00, 0x30, 0x6F, 0x00, 0x00, 0x00, 0xA0, 0x1F, 0x00, 0xC0, 0x09, 0xF0, 0x09, 0x00, 0xF0,
+    0x09, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x30, 0x6F, 0x00, 0xF0, 0x09, 0x00, 0xDE, 0x00,
+    0x60, 0x3F, 0x00, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x90, 0x0F, 0xF0, 0x09, 0x70, 0xFD, 0x09, 0xA0,
+    0x0E, 0x00, 0xF5, 0x05, 0x60, 0x3F, 0x00, 0x00, 0x00, 0xA0, 0x0E, 0x00, 0xF5, 0x05, 0xC0, 0x0C,
+    0x00, 0xF3, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x08, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xC0, 0x0C, 0x00,
+    0xF3, 0x05, 0x00, 0xE0, 0xE8, 0x08, 0x00, 0x90, 0xCE, 0x20, 0xFE, 0x03, 0x40, 0x6F, 0x00, 0xEA,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0x08, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0xF7, 0x03, 0x60, 0x3F,
+    0x00, 0xF1, 0x07, 0x30, 0x6F, 0x00, 0x00, 0x00, 0xC0, 0x0B, 0x00, 0xF8, 0x03, 0xB0, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x3F, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0xF9, 0x03, 0x60, 0x0F, 0x00, 0xF3,
+    0x03, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x30, 0x6F, 0x30, 0x8F, 0x00,
+    0x00, 0x60, 0x0F, 0x00, 0x00, 0xF3, 0x03, 0x9C, 0x60, 0x0C, 0x60, 0x0F, 0x00, 0xF3, 0x03, 0xB0,
+    0x0E, 0x00, 0xF3, 0x05, 0x90, 0x3F, 0x00, 0xF1, 0x07, 0xB0, 0x0D, 0x00, 0xF7, 0x03, 0x00, 0xF3,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x90, 0x0C, 0x00, 0x00, 0x60, 0x0F, 0x00,
+    0xF7, 0x03, 0x00, 0xF0, 0xC7, 0x0A, 0x00, 0x80, 0xDC, 0x81, 0xF9, 0x02, 0x00, 0xF8, 0x71, 0x3F,
+    0x00, 0x00, 0xB0, 0xDB, 0x09, 0x00, 0x00, 0xF7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x00, 0x00,
+    0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0D,
+    0xF3, 0x00, 0x00, 0x80, 0x49, 0x88, 0xF7, 0x05, 0x00, 0x00, 0xC7, 0x31, 0x2F, 0xE1, 0x3C, 0x20,
+    0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xCF, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x20,
+    0xAF, 0x20, 0xBE, 0x00, 0x00, 0x65, 0xFA, 0x68, 0x03, 0x80, 0x8F, 0x66, 0x66, 0x01, 0xC0, 0x35,
+    0x53, 0xEE, 0x01, 0x00, 0x00, 0x30, 0x6F, 0x00, 0x80, 0x35, 0x73, 0xBF, 0x00, 0x20, 0x9F, 0x10,
+    0xFA, 0x01, 0x00, 0xC0, 0x0D, 0x00, 0x00, 0xA0, 0x7F, 0x10, 0xFA, 0x03, 0x10, 0x36, 0x73, 0x8F,
+    0x00, 0x00, 0x30, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x03, 0x00, 0x00, 0x00, 0x00, 0x30, 0x6F, 0x00, 0x00, 0xE6,
+    0x00, 0xF8, 0xBF, 0x3F, 0xF4, 0x05, 0x00, 0xB0, 0x0E, 0xC0, 0x3D, 0x63, 0xFA, 0x07, 0x00, 0xFC,
+    0x05, 0x71, 0x05, 0xF0, 0x4A, 0xC6, 0x6F, 0x00, 0x60, 0x8F, 0x66, 0x66, 0x03, 0x30, 0x6F, 0x00,
+    0x00, 0x00, 0x10, 0xCF, 0x03, 0xE3, 0x09, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0x20, 0x66, 0xCF, 0x66,
+    0x00, 0xC3, 0x05, 0xB1, 0x1F, 0x00, 0xF0, 0x09, 0x00, 0xF5, 0x08, 0x60, 0x8F, 0x66, 0x66, 0x05,
+    0xF6, 0x03, 0x00, 0x90, 0x0F, 0xF0, 0x09, 0x10, 0xFF, 0x09, 0x30, 0x9F, 0x31, 0xDE, 0x00, 0x60,
+    0x3F, 0x00, 0x00, 0x00, 0x30, 0x9F, 0x31, 0xDE, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0D, 0xB0, 0x27,
+    0x20, 0xFA, 0x03, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x70, 0x7F, 0x10, 0xFC, 0x01, 0x00, 0x80, 0xFE,
+    0x03, 0x00, 0x70, 0x8F, 0x00, 0xFE, 0x01, 0xE0, 0x0C, 0x00, 0xF1, 0x08, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x90, 0x7F, 0x66, 0x66, 0x16, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1F, 0x00,
+    0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x1D, 0x40, 0xFF, 0x03, 0x60, 0xCF, 0x01, 0xFA, 0x01, 0x00, 0xFB,
+    0x05, 0x50, 0x02, 0x70, 0x6F, 0x40, 0xFF, 0x03, 0x40, 0x8F, 0x01, 0x71, 0x05, 0x00, 0x30, 0x3F,
+    0x00, 0x00, 0x50, 0x7F, 0x53, 0xFE, 0x03, 0x60, 0x0F, 0x00, 0xF3, 0x03, 0x10, 0x33, 0xAD, 0x33,
+    0x01, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x30, 0x6F, 0x00, 0xF7, 0x04, 0x00, 0x10, 0x9F, 0x33, 0x00,
+    0xF3, 0x03, 0x9C, 0x60, 0x0C, 0x60, 0x0F, 0x00, 0xF3, 0x03, 0x50, 0x7F, 0x10, 0xEC, 0x00, 0x90,
+    0xCF, 0x01, 0xFA, 0x01, 0x50, 0x7F, 0x20, 0xFE, 0x03, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x40, 0x17,
+    0x10, 0xDC, 0x00, 0x00, 0x70, 0x5F, 0x33, 0x00, 0x30, 0x7F, 0x30, 0xFD, 0x03, 0x00, 0xA0, 0xFE,
+    0x04, 0x00, 0x50, 0xEF, 0x30, 0xEF, 0x00, 0x40, 0x5F, 0x00, 0xEB, 0x00, 0x00, 0x50, 0xFF, 0x03,
+    0x00, 0x30, 0x8F, 0x33, 0x33, 0x00, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x08, 0xC7, 0x00, 0x00, 0x30, 0xEA,
+    0xFF, 0x5C, 0x00, 0x00, 0x00, 0x80, 0xEF, 0x05, 0x30, 0xFD, 0xFF, 0x8A, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x10, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xCF, 0x00, 0x00, 0x30, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x1C, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x09, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00,
+    0x30, 0x6F, 0x00, 0xB0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0xF5, 0xFF, 0x5E, 0x00, 0x00, 0xF3, 0x07,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0x5E, 0x00, 0x20, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x30, 0xCF, 0x00,
+    0x00, 0x00, 0x10, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x6F, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xF8,
+    0x01, 0x00, 0x70, 0x3F, 0xC0, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0xA0, 0xFF, 0xEF, 0x04, 0xF0, 0xFF,
+    0xBF, 0x04, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x30, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF,
+    0xCF, 0x03, 0xF0, 0x09, 0x00, 0xF0, 0x09, 0x60, 0xFF, 0xFF, 0xFF, 0x00, 0xC1, 0xFF, 0xFF, 0x06,
+    0x00, 0xF0, 0x09, 0x00, 0xA0, 0x3F, 0x60, 0xFF, 0xFF, 0xFF, 0x0C, 0xF6, 0x03, 0x00, 0x90, 0x0F,
+    0xF0, 0x09, 0x00, 0xFA, 0x09, 0x00, 0xF6, 0xFF, 0x1D, 0x00, 0x60, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0x2E, 0x00, 0xC0, 0x0C, 0x00, 0x40, 0x5F, 0x80, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x3E, 0x00, 0x00, 0x40, 0xEF, 0x00, 0x00, 0x50, 0x5F, 0x00,
+    0xFB, 0x00, 0xF8, 0x02, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
+    0x3F, 0x00, 0x60, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFE, 0xEF, 0xF7, 0x03, 0x60, 0x8F, 0xFF, 0x5F, 0x00, 0x00, 0xA0, 0xFF, 0xEF, 0x01, 0x00, 0xF8,
+    0xFF, 0xF7, 0x03, 0x00, 0xE5, 0xFF, 0xEF, 0x03, 0x00, 0x30, 0x3F, 0x00, 0x00, 0x00, 0xF7, 0xDF,
+    0xF5, 0x03, 0x60, 0x0F, 0x00, 0xF3, 0x03, 0x90, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF6, 0x03,
+    0x00, 0x30, 0x6F, 0x00, 0xB0, 0x1E, 0x00, 0x00, 0xE5, 0xFF, 0x00, 0xF3, 0x03, 0x9C, 0x60, 0x0C,
+    0x60, 0x0F, 0x00, 0xF3, 0x03, 0x00, 0xF8, 0xFF, 0x3D, 0x00, 0x90, 0x9F, 0xFF, 0x5F, 0x00, 0x00,
+    0xF8, 0xFF, 0xF8, 0x03, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0x3D, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0x00, 0x00, 0xF9, 0xEF, 0xF7, 0x03, 0x00, 0x40, 0xEF, 0x00, 0x00, 0x10, 0x8F, 0x00,
+    0xBE, 0x00, 0xE1, 0x0A, 0x00, 0xE1, 0x0A, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3,
+    0x01, 0x00, 0x00, 0x70, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x33,
+    0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x31, 0x03, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x32, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x23, 0x00, 0x00, 0x90, 0x0F, 0x31, 0x00, 0x00, 0x00, 0x10, 0x13, 0xF3, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x00,
+    0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x08, 0x00, 0x00, 0xE0, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE4, 0xAE, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x61,
+    0x01, 0x00, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x9A, 0x00, 0x00, 0x00, 0x6C, 0x00,
+    0x00, 0x10, 0xC9, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x56, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0xEC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xEC, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFE, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x99, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x10, 0x89, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x99, 0x99, 0x99, 0x99, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x56, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x56, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00,
+};
+
+static const font_glyph_t font_mono16_glyphs[] = {
+    {0, 10, 0, 10}, // ' '
+    {10, 10, 0, 10}, // '!'
+    {20, 10, 0, 10}, // '"'
+    {30, 10, 0, 10}, // '#'
+    {40, 10, 0, 10}, // '$'
+    {50, 10, 0, 10}, // '%'
+    {60, 10, 0, 10}, // '&'
+    {70, 10, 0, 10}, // '''
+    {80, 10, 0, 10}, // '('
+    {90, 10, 0, 10}, // ')'
+    {100, 10, 0, 10}, // '*'
+    {110, 10, 0, 10}, // '+'
+    {120, 10, 0, 10}, // ','
+    {130, 10, 0, 10}, // '-'
+    {140, 10, 0, 10}, // '.'
+    {150, 10, 0, 10}, // '/'
+    {160, 10, 0, 10}, // '0'
+    {170, 10, 0, 10}, // '1'
+    {180, 10, 0, 10}, // '2'
+    {190, 10, 0, 10}, // '3'
+    {200, 10, 0, 10}, // '4'
+    {210, 10, 0, 10}, // '5'
+    {220, 10, 0, 10}, // '6'
+    {230, 10, 0, 10}, // '7'
+    {240, 10, 0, 10}, // '8'
+    {250, 10, 0, 10}, // '9'
+    {260, 10, 0, 10}, // ':'
+    {270, 10, 0, 10}, // ';'
+    {280, 10, 0, 10}, // '<'
+    {290, 10, 0, 10}, // '='
+    {300, 10, 0, 10}, // '>'
+    {310, 10, 0, 10}, // '?'
+    {320, 10, 0, 10}, // '@'
+    {330, 10, 0, 10}, // 'A'
+    {340, 10, 0, 10}, // 'B'
+    {350, 10, 0, 10}, // 'C'
+    {360, 10, 0, 10}, // 'D'
+    {370, 10, 0, 10}, // 'E'
+    {380, 10, 0, 10}, // 'F'
+    {390, 10, 0, 10}, // 'G'
+    {400, 10, 0, 10}, // 'H'
+    {410, 10, 0, 10}, // 'I'
+    {420, 10, 0, 10}, // 'J'
+    {430, 10, 0, 10}, // 'K'
+    {440, 10, 0, 10}, // 'L'
+    {450, 10, 0, 10}, // 'M'
+    {460, 10, 0, 10}, // 'N'
+    {470, 10, 0, 10}, // 'O'
+    {480, 10, 0, 10}, // 'P'
+    {490, 10, 0, 10}, // 'Q'
+    {500, 10, 0, 10}, // 'R'
+    {510, 10, 0, 10}, // 'S'
+    {520, 10, 0, 10}, // 'T'
+    {530, 10, 0, 10}, // 'U'
+    {540, 10, 0, 10}, // 'V'
+    {550, 10, 0, 10}, // 'W'
+    {560, 10, 0, 10}, // 'X'
+    {570, 10, 0, 10}, // 'Y'
+    {580, 10, 0, 10}, // 'Z'
+    {590, 10, 0, 10}, // '['
+    {600, 10, 0, 10}, // '\'
+    {610, 10, 0, 10}, // ']'
+    {620, 10, 0, 10}, // '^'
+    {630, 10, 0, 10}, // '_'
+    {640, 10, 0, 10}, // '`'
+    {650, 10, 0, 10}, // 'a'
+    {660, 10, 0, 10}, // 'b'
+    {670, 10, 0, 10}, // 'c'
+    {680, 10, 0, 10}, // 'd'
+    {690, 10, 0, 10}, // 'e'
+    {700, 10, 0, 10}, // 'f'
+    {710, 10, 0, 10}, // 'g'
+    {720, 10, 0, 10}, // 'h'
+    {730, 10, 0, 10}, // 'i'
+    {740, 10, 0, 10}, // 'j'
+    {750, 10, 0, 10}, // 'k'
+    {760, 10, 0, 10}, // 'l'
+    {770, 10, 0, 10}, // 'm'
+    {780, 10, 0, 10}, // 'n'
+    {790, 10, 0, 10}, // 'o'
+    {800, 10, 0, 10}, // 'p'
+    {810, 10, 0, 10}, // 'q'
+    {820, 10, 0, 10}, // 'r'
+    {830, 10, 0, 10}, // 's'
+    {840, 10, 0, 10}, // 't'
+    {850, 10, 0, 10}, // 'u'
+    {860, 10, 0, 10}, // 'v'
+    {870, 10, 0, 10}, // 'w'
+    {880, 10, 0, 10}, // 'x'
+    {890, 10, 0, 10}, // 'y'
+    {900, 10, 0, 10}, // 'z'
+    {910, 10, 0, 10}, // '{'
+    {920, 10, 0, 10}, // '|'
+    {930, 10, 0, 10}, // '}'
+    {940, 10, 0, 10}, // '~'
+};
+
+static const font_t font_mono16 = {
+    .format = GFX_FORMAT_A4,
+    .height = 19,
+    .atlas_width = 950,
+    .first_char = 32,
+    .glyph_count = 95,
+    .glyphs = font_mono16_glyphs,
+    .atlas = font_mono16_atlas,
+};
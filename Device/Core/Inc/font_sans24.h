@@ -0,0 +1,1408 @@
+// Generated automatically - do not edit
+// DejaVuSans.ttf at 24 px, A4, 1428x29 atlas
+
+static const uint8_t font_sans24_atlas[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x13, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+    0x33, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x20, 0x13, 0x00, 0x00, 0x32,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x33, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00,
+    0x00, 0x30, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x66, 0x00, 0x00, 0x00, 0x63, 0x02, 0x61, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x01, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xCB, 0x3A, 0x00, 0x00, 0x00, 0x30, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xC8, 0xBC, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x02, 0x00, 0x00, 0x00, 0xD0,
+    0x1F, 0x00, 0x00, 0xFA, 0x03, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x70, 0xCB, 0x8C, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x66, 0x16, 0x00, 0x00, 0x00, 0x00, 0x30, 0xB8, 0xCC, 0x6A, 0x00, 0x00,
+    0x00, 0x00, 0x51, 0xB8, 0xCC, 0x8B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x26, 0x00,
+    0x00, 0x00, 0x62, 0x66, 0x66, 0x66, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xCC, 0x7A, 0x01,
+    0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x16, 0x00, 0x00, 0x00, 0x82, 0xCC, 0x9C, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x82, 0xCC, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xC9, 0xBC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x66, 0x66, 0x66,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xCB, 0xAC, 0x27, 0x00, 0x00, 0x00, 0x63, 0x66, 0x66,
+    0x66, 0x03, 0x00, 0x00, 0x00, 0x00, 0x63, 0x66, 0x66, 0x66, 0x66, 0x26, 0x00, 0x00, 0x63, 0x66,
+    0x66, 0x66, 0x66, 0x02, 0x00, 0x00, 0x00, 0x83, 0xCB, 0xCC, 0x58, 0x00, 0x00, 0x00, 0x00, 0x63,
+    0x05, 0x00, 0x00, 0x00, 0x30, 0x36, 0x00, 0x00, 0x63, 0x05, 0x00, 0x00, 0x00, 0x63, 0x05, 0x00,
+    0x00, 0x63, 0x05, 0x00, 0x00, 0x00, 0x64, 0x16, 0x00, 0x00, 0x63, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x63, 0x66, 0x00, 0x00, 0x00, 0x00, 0x61, 0x66, 0x02, 0x00, 0x00, 0x63, 0x46, 0x00, 0x00,
+    0x00, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x95, 0xCC, 0x8C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x63,
+    0x66, 0x66, 0x56, 0x01, 0x00, 0x00, 0x00, 0x00, 0x95, 0xCC, 0x8C, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x63, 0x66, 0x66, 0x56, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xCC, 0xAC, 0x58, 0x00, 0x00,
+    0x60, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x00, 0x66, 0x02, 0x00, 0x00, 0x00, 0x50, 0x26,
+    0x00, 0x64, 0x05, 0x00, 0x00, 0x00, 0x00, 0x20, 0x66, 0x00, 0x61, 0x16, 0x00, 0x00, 0x00, 0x63,
+    0x16, 0x00, 0x00, 0x00, 0x63, 0x05, 0x10, 0x66, 0x01, 0x00, 0x00, 0x00, 0x62, 0x06, 0x50, 0x46,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x36, 0x30, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x00, 0xFF,
+    0xFF, 0x0F, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x61, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0x06, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xFD, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0xFF, 0x7E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x00, 0x00, 0x00, 0xF9, 0x06, 0xF3, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0x05, 0x30, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xAE,
+    0xFF, 0x05, 0x00, 0x00, 0xD0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0x06, 0x00, 0x00, 0x00, 0xF7, 0x08, 0x00, 0x00, 0xF2, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xCF, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xDF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0xCC, 0xCC, 0x7A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x00, 0x00, 0xC3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x90, 0x9F,
+    0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x70,
+    0xFF, 0x09, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x04, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0xFF, 0x01, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0x00,
+    0xD3, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xAF, 0x01,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xCF, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0xF7, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xDF, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xFB, 0x7F, 0x00, 0x00, 0x00, 0xFB, 0x0A,
+    0x00, 0xFC, 0x0B, 0x00, 0x00, 0x00, 0xFD, 0x0A, 0x60, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xF8, 0x1E,
+    0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xFF, 0x68, 0x06, 0x00, 0xFA, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x63, 0xE6, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xDF, 0x99, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xC0,
+    0x6F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xDF, 0x68, 0x01, 0x00,
+    0x00, 0xF0, 0x0F, 0x00, 0x00, 0x60, 0xB7, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x00, 0x00, 0x00,
+    0xF9, 0x06, 0xF3, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x01, 0x70, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xF6, 0x68, 0x03, 0x00, 0x00, 0x30, 0xCF, 0x00, 0xF1, 0x0E, 0x00, 0x00, 0xF7, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x3A, 0x20, 0xD6, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x06,
+    0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xB0, 0x5F, 0x00, 0x00, 0x80, 0x02, 0x90, 0x09, 0x20,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0xD0, 0xEF,
+    0x04, 0xB3, 0xFF, 0x02, 0x00, 0x00, 0xF6, 0xEF, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x30, 0xEF, 0x59,
+    0x33, 0xF7, 0xEF, 0x01, 0x00, 0x00, 0xA8, 0x47, 0x33, 0xC6, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xD0, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xF6, 0x6E, 0x66, 0x66, 0x56, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0x6D, 0x33, 0x95, 0x08, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0xFD, 0x0D, 0x00, 0x00, 0xF6, 0xAF,
+    0x03, 0x72, 0xFF, 0x0A, 0x00, 0x00, 0xF7, 0x9F, 0x02, 0xC4, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xAF, 0x35, 0x73, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xCF,
+    0xDC, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x6E, 0x66, 0x86, 0xFE, 0x5F, 0x00, 0x00, 0x30, 0xFF, 0x8F, 0x34, 0x43, 0xE8, 0x6F, 0x00,
+    0x00, 0xF9, 0x6E, 0x66, 0x97, 0xFC, 0xFF, 0x08, 0x00, 0x00, 0xF9, 0x6E, 0x66, 0x66, 0x66, 0x26,
+    0x00, 0x00, 0xF9, 0x6E, 0x66, 0x66, 0x66, 0x02, 0x00, 0x30, 0xFF, 0x9F, 0x35, 0x33, 0xC7, 0xFF,
+    0x03, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00,
+    0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9, 0x7F, 0x00, 0x00, 0x00, 0xF9, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x06, 0x00, 0x00,
+    0xF9, 0xFF, 0x09, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0x30, 0xFF, 0x7E, 0x33, 0x73, 0xFE, 0x3F,
+    0x00, 0x00, 0x00, 0xF9, 0x6E, 0x66, 0xD8, 0xFF, 0x0B, 0x00, 0x30, 0xFF, 0x7E, 0x33, 0x73, 0xFE,
+    0x3F, 0x00, 0x00, 0x00, 0xF9, 0x6E, 0x66, 0xC7, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xFA, 0x8F, 0x33,
+    0x33, 0xC7, 0x0C, 0x00, 0x60, 0x66, 0x66, 0xE6, 0xCF, 0x66, 0x66, 0x56, 0x00, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0xC0, 0x6F, 0x00, 0xF1, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0xB0, 0xAF,
+    0x00, 0x00, 0x00, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0xF2, 0x6F, 0x00, 0x00, 0x80,
+    0xEF, 0x01, 0x00, 0xFA, 0x0D, 0x00, 0x00, 0x30, 0xFF, 0x05, 0x30, 0x66, 0x66, 0x66, 0x66, 0x76,
+    0xFF, 0x0E, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xF6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0xE1, 0xEF, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x02, 0x00, 0x00, 0x50, 0x26, 0x00, 0x00, 0xFC, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x00, 0x00, 0x00, 0xF9, 0x06, 0xF3, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xDF, 0x00, 0xB0, 0x1F, 0x00, 0x00, 0x00, 0x50, 0xFE, 0xFF, 0xFF, 0xFF, 0x02,
+    0x00, 0x80, 0x5F, 0x00, 0xA0, 0x4F, 0x00, 0x10, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x06, 0x00, 0x00, 0x70, 0xAF, 0x00, 0x00,
+    0x00, 0x40, 0xCF, 0x00, 0x00, 0xD1, 0x8F, 0x90, 0x09, 0xF8, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0x1F, 0x00, 0x00, 0xF6, 0x1F, 0x00, 0x00, 0xFD, 0x0A, 0x00, 0x00,
+    0x52, 0x01, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00, 0x30, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF7, 0x6F, 0x00, 0x00, 0x00,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0xFC, 0x0C, 0x00, 0x00, 0xF7, 0x1F, 0x00, 0x00,
+    0xFF, 0x09, 0x00, 0x00, 0xFD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0x00,
+    0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x38, 0x00, 0x00, 0x50, 0xFC, 0x3E, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xEF, 0xF8, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xC0, 0xEF,
+    0x00, 0x00, 0xF1, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x20,
+    0xFC, 0x7F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xCF, 0x01, 0x00, 0x00, 0x00, 0xD3, 0x03, 0x00, 0x00, 0xF9, 0x0C, 0x00,
+    0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9,
+    0x0C, 0x00, 0x90, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0xFA, 0x0F, 0x00, 0x00, 0x40, 0xBF, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0xFD, 0x2F, 0x00, 0x00, 0x90,
+    0x9F, 0x00, 0x00, 0xF1, 0xCF, 0x01, 0x00, 0x00, 0xE1, 0xEF, 0x01, 0x00, 0x00, 0xF9, 0x0C, 0x00,
+    0x00, 0xF9, 0x4F, 0x00, 0xF1, 0xCF, 0x01, 0x00, 0x00, 0xE1, 0xEF, 0x01, 0x00, 0x00, 0xF9, 0x0C,
+    0x00, 0x00, 0xF7, 0x5F, 0x00, 0x00, 0x10, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0xA0,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x1F, 0x00, 0x70, 0xEF, 0x00, 0x00, 0x30, 0xBF, 0xEF, 0x00,
+    0x00, 0x30, 0xFF, 0x02, 0x00, 0x70, 0xFF, 0x01, 0x00, 0xF4, 0x5F, 0x00, 0x00, 0xE1, 0x8F, 0x00,
+    0x00, 0xD0, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x02, 0x00, 0xFF, 0x03, 0x00,
+    0x00, 0xF1, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0x00, 0x10, 0xFE, 0x0C,
+    0xA0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0x00, 0x00, 0x00, 0xF9, 0x06, 0xF3, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x50, 0x8F, 0x00, 0xF0,
+    0x0E, 0x00, 0x00, 0x00, 0xF5, 0x8F, 0xF3, 0x55, 0xE9, 0x03, 0x00, 0x90, 0x3F, 0x00, 0x70, 0x6F,
+    0x00, 0xA0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x06, 0x00, 0x00, 0xC0, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00,
+    0xD5, 0xCD, 0xDC, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x0E,
+    0x00, 0x00, 0xFC, 0x09, 0x00, 0x00, 0xF5, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x0F,
+    0x00, 0x00, 0x00, 0x30, 0xDF, 0xF0, 0x6F, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x01,
+    0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x50, 0xFF, 0x01, 0x00, 0x00, 0xF7, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0F, 0x00, 0x00, 0x00,
+    0xF9, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xA0, 0x9F, 0xF3, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x60, 0xFF, 0x00, 0x00, 0xFA, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0xF9, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x1E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00,
+    0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0xF9, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xA9, 0x6F, 0x00, 0x00, 0xA0, 0x5F,
+    0xFF, 0x06, 0x00, 0x00, 0xF9, 0xC9, 0xAF, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0xFA, 0x1F, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0x08, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF0, 0x8F, 0x00, 0xFA, 0x1F,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0x08, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF0, 0x9F, 0x00, 0x00,
+    0x60, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x40, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFB,
+    0x0A, 0x00, 0x30, 0xFF, 0x02, 0x00, 0x70, 0x7F, 0xFB, 0x02, 0x00, 0x70, 0xEF, 0x00, 0x00, 0x00,
+    0xFC, 0x0B, 0x00, 0xFE, 0x0A, 0x00, 0x00, 0x50, 0xFF, 0x03, 0x00, 0xF8, 0x1E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0x5F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0x00, 0xE1, 0xAF, 0x00, 0x00, 0xF9, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x66,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x51, 0x56, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x65,
+    0x56, 0x01, 0x00, 0x00, 0x00, 0x50, 0x66, 0x01, 0xF3, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x65, 0x36,
+    0x00, 0x00, 0x00, 0x31, 0xF8, 0x3D, 0x33, 0x01, 0x00, 0x00, 0x50, 0x66, 0x01, 0x30, 0x03, 0x00,
+    0x00, 0xFC, 0x06, 0x51, 0x56, 0x01, 0x00, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x20, 0x13, 0x00,
+    0x00, 0xFC, 0x06, 0x00, 0x00, 0x30, 0x13, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x32, 0x01, 0x51, 0x56,
+    0x01, 0x00, 0x30, 0x66, 0x03, 0x00, 0x00, 0x00, 0x32, 0x01, 0x51, 0x56, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x66, 0x15, 0x00, 0x00, 0x00, 0x00, 0x32, 0x01, 0x51, 0x56, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x66, 0x01, 0x30, 0x03, 0x00, 0x00, 0x32, 0x01, 0x51, 0x56, 0x00, 0x00, 0x63, 0x66,
+    0x14, 0x00, 0x00, 0x31, 0xFD, 0x38, 0x33, 0x02, 0x00, 0x33, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00,
+    0x30, 0x03, 0x00, 0x00, 0x00, 0x20, 0x13, 0x30, 0x03, 0x00, 0x00, 0x31, 0x03, 0x00, 0x00, 0x31,
+    0x01, 0x20, 0x13, 0x00, 0x00, 0x00, 0x31, 0x03, 0x30, 0x03, 0x00, 0x00, 0x00, 0x20, 0x13, 0x10,
+    0x33, 0x33, 0x33, 0x33, 0x13, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x00, 0x00, 0x00, 0xF9, 0x06,
+    0xF3, 0x0C, 0x00, 0x00, 0x50, 0x66, 0xA6, 0xAF, 0x66, 0xF8, 0x6C, 0x66, 0x01, 0x00, 0xFC, 0x07,
+    0xF0, 0x03, 0x00, 0x00, 0x00, 0x90, 0x3F, 0x00, 0x70, 0x6F, 0x00, 0xF4, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x06, 0x00, 0x00,
+    0xF2, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x08, 0x00, 0x00, 0x00, 0xF9, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x08, 0x00, 0x00, 0xFF, 0x05, 0x00, 0x00,
+    0xF0, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x0D, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0xF0,
+    0x6F, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xAF, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
+    0xF3, 0x2F, 0x00, 0x60, 0xFF, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x61, 0x16, 0x00, 0x00,
+    0x61, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFD, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xEF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0D, 0x00, 0x00, 0x70, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0x0D, 0x00, 0x00, 0x00, 0xF1, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C,
+    0x00, 0x00, 0x60, 0xFF, 0x00, 0x10, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0x0C, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x08, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9,
+    0x0C, 0x00, 0x00, 0xF9, 0x0C, 0xC0, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0x49, 0xCF, 0x00, 0x00, 0xF1, 0x0F, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0x39,
+    0xFF, 0x02, 0x00, 0x90, 0x9F, 0x00, 0x10, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x0E, 0x00,
+    0x00, 0xF9, 0x0C, 0x00, 0x00, 0xC0, 0x9F, 0x10, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x0E,
+    0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x60, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0xC0, 0x6F, 0x00, 0x00, 0xFE, 0x08, 0x00, 0x00, 0x10, 0xFF, 0x05, 0x00, 0x00, 0xFF, 0x07, 0x00,
+    0xB0, 0x3F, 0xF7, 0x07, 0x00, 0xA0, 0xAF, 0x00, 0x00, 0x00, 0xF2, 0x6F, 0x90, 0xEF, 0x01, 0x00,
+    0x00, 0x00, 0xFA, 0x0D, 0x30, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x08, 0x00,
+    0x00, 0xFF, 0x03, 0x00, 0x00, 0x70, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00,
+    0x10, 0xFE, 0x09, 0x00, 0x00, 0x70, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFC,
+    0x76, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x10, 0xFA, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x30, 0xFE,
+    0xFF, 0xAF, 0xF3, 0x0F, 0x00, 0x00, 0x10, 0xFA, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0x06, 0x00, 0x50, 0xFE, 0xFF, 0xAF, 0xF3, 0x0F, 0x00, 0x00, 0xFC, 0x56, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x10, 0xFD,
+    0x0C, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xFC, 0x66, 0xFF, 0xFF, 0x3F, 0x10, 0xFC, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0xFC, 0x56, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xFC, 0x76, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0xAF, 0xF3, 0x0F,
+    0x00, 0x00, 0xFC, 0x66, 0xFF, 0xCF, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF6, 0xFF, 0xFF,
+    0xFF, 0x0C, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0xF1, 0x3F, 0x00, 0x00, 0x00, 0xF1,
+    0x4F, 0xD0, 0x5F, 0x00, 0x00, 0xFA, 0x4F, 0x00, 0x00, 0xFA, 0x07, 0x70, 0xFF, 0x02, 0x00, 0x00,
+    0xFC, 0x0B, 0xF1, 0x3F, 0x00, 0x00, 0x00, 0xF1, 0x3F, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0x00, 0x00, 0x00, 0xF9, 0x06, 0xF3, 0x0C, 0x00, 0x00, 0xC0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFF, 0x03, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x80,
+    0x6F, 0x00, 0xA0, 0x3F, 0x00, 0xED, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x06, 0x00, 0x00, 0xF7, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x0C, 0x00, 0x00, 0x81, 0xEF, 0xFE, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x03, 0x00, 0x30, 0xFF, 0x02, 0x00, 0x00, 0xD0, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0x08, 0x00, 0x00, 0x00, 0xF7, 0x08, 0xF0, 0x6F, 0x00, 0x00, 0x00, 0xF6, 0x6D,
+    0x99, 0x16, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x85, 0x69, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0x4F, 0x00, 0x00, 0x00, 0xF8, 0x0C, 0x00, 0x00, 0xF8, 0x0D, 0x00, 0x60, 0xEF, 0x00,
+    0x00, 0x00, 0xF3, 0x6F, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB6, 0xFF, 0xEF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xFE, 0xFF, 0x6C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0x05, 0x00, 0x00, 0xF2, 0x0D, 0x00, 0x10, 0x97, 0x37, 0x30, 0x06, 0x70, 0x7F, 0x00, 0x00, 0x00,
+    0xF6, 0x0E, 0x70, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xA0, 0xBF, 0x00, 0x50,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0x0C, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00,
+    0x90, 0x9F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9, 0x0C, 0xFC,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0xFE,
+    0x01, 0x00, 0xF6, 0x09, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0x09, 0xFA, 0x0C, 0x00, 0x90, 0x9F, 0x00,
+    0x50, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x3F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xE0,
+    0x9F, 0x50, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x3F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00,
+    0xF0, 0x8F, 0x00, 0x00, 0x40, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xF8, 0x0E,
+    0x00, 0x00, 0x80, 0xEF, 0x00, 0x00, 0x00, 0xFB, 0x0A, 0x00, 0xF0, 0x0F, 0xF3, 0x0A, 0x00, 0xE0,
+    0x7F, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xF6, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x8F, 0xD0, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x10,
+    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xE1, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE9, 0x7A, 0x76, 0xFA, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x6B, 0xB6, 0xFF, 0x07, 0x00,
+    0x00, 0xE1, 0xFF, 0x69, 0x86, 0xCE, 0x00, 0x00, 0xF3, 0xCF, 0x67, 0xF9, 0xFD, 0x0F, 0x00, 0x00,
+    0xE1, 0xEF, 0x68, 0xC7, 0xFF, 0x03, 0x00, 0x93, 0xFC, 0x9E, 0x99, 0x03, 0x00, 0xF4, 0xCF, 0x67,
+    0xF9, 0xFD, 0x0F, 0x00, 0x00, 0xFC, 0xFC, 0x7C, 0xC7, 0xFF, 0x05, 0x00, 0x00, 0xFC, 0x06, 0x00,
+    0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0xE2, 0xAF, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00,
+    0xFC, 0xFC, 0x7B, 0xD7, 0xFF, 0xE1, 0x8E, 0x96, 0xFF, 0x08, 0x00, 0x00, 0xFC, 0xFC, 0x7C, 0xC7,
+    0xFF, 0x05, 0x00, 0x00, 0xF3, 0xDF, 0x67, 0xF9, 0xCF, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x6B, 0xB6,
+    0xFF, 0x07, 0x00, 0x00, 0xF3, 0xCF, 0x67, 0xF9, 0xFD, 0x0F, 0x00, 0x00, 0xFC, 0xFC, 0x8C, 0x87,
+    0x20, 0xFF, 0x7C, 0x66, 0xC8, 0x09, 0x00, 0x93, 0xFE, 0x9C, 0x99, 0x07, 0x00, 0xFF, 0x03, 0x00,
+    0x00, 0xF3, 0x0F, 0x00, 0xA0, 0x9F, 0x00, 0x00, 0x00, 0xF6, 0x0E, 0x80, 0x8F, 0x00, 0x00, 0xFE,
+    0x8F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0xFA, 0x0D, 0x00, 0x80, 0xEF, 0x01, 0x90, 0xAF, 0x00, 0x00,
+    0x00, 0xF7, 0x0D, 0x50, 0x99, 0x99, 0x99, 0xFA, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x66, 0xF7, 0x6E, 0x66, 0xFE, 0x67, 0x66,
+    0x01, 0x00, 0xFF, 0x05, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x20, 0xDF, 0x00, 0xF3, 0x0E, 0x70, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0x09, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x70, 0xDF, 0x93,
+    0x39, 0xFD, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xEF, 0x00, 0x00, 0x60,
+    0xFF, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x61, 0x66, 0xE7, 0xBF, 0x00, 0x00, 0x00,
+    0x20, 0xEF, 0x00, 0xF0, 0x6F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x30,
+    0xFF, 0xD4, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0E, 0x00, 0x00, 0x00,
+    0xC0, 0xCF, 0x34, 0x83, 0xFF, 0x03, 0x00, 0x60, 0xFF, 0x00, 0x00, 0x00, 0xF5, 0x8F, 0x00, 0x00,
+    0xF3, 0x3F, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFA, 0xFF, 0xAF, 0x04, 0x00,
+    0x00, 0x00, 0xC5, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x00, 0x00, 0x00, 0x30, 0xE9, 0xFF,
+    0xAF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x6F, 0x00, 0x00, 0x00, 0xF9, 0x03, 0x00,
+    0xF3, 0xFF, 0xFF, 0x99, 0x0F, 0x00, 0xEE, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x10, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0xF9, 0x3D, 0x33, 0x63, 0xFC, 0x3F, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0F, 0x00, 0xF9, 0x6E, 0x66, 0x66,
+    0x66, 0x06, 0x00, 0x00, 0xF9, 0x6E, 0x66, 0x66, 0x36, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x6E, 0x66, 0x66, 0x66, 0xC6, 0x9F, 0x00, 0x00, 0xF9, 0x0C,
+    0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9, 0xCD, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0xF8, 0x08, 0x00, 0xFC, 0x03, 0xFF, 0x06,
+    0x00, 0x00, 0xF9, 0x09, 0xF2, 0x3F, 0x00, 0x90, 0x9F, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0x6F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF4, 0x7F, 0x80, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0x6F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF7, 0x5F, 0x00, 0x00, 0x00, 0xFD,
+    0xCF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xF1, 0x4F, 0x00, 0x00, 0xE0, 0x8F, 0x00, 0x00,
+    0x00, 0xF7, 0x0E, 0x00, 0xF3, 0x0B, 0xF0, 0x0E, 0x00, 0xF2, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFA, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x0E, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x60, 0xFF,
+    0x01, 0x00, 0x00, 0xFC, 0x8F, 0x00, 0x00, 0xF7, 0x1F, 0x00, 0x00, 0xFB, 0x1E, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0xFD, 0x0B, 0x00, 0x30, 0xFF, 0x0F, 0x00, 0x00, 0xFB, 0x0C, 0x00, 0x00, 0xFA, 0x0C,
+    0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0xFD, 0x0A, 0x00, 0x30, 0xFF, 0x0F, 0x00, 0x00, 0xFC,
+    0x6F, 0x00, 0x00, 0xFA, 0x0C, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC,
+    0x06, 0x30, 0xFF, 0x09, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xFC, 0x6F, 0x00, 0x00, 0xFD, 0xCE,
+    0x00, 0x00, 0xF7, 0x0F, 0x00, 0x00, 0xFC, 0x6F, 0x00, 0x00, 0xFA, 0x0C, 0x00, 0x00, 0xFD, 0x0C,
+    0x00, 0x30, 0xFF, 0x08, 0x00, 0x00, 0xFC, 0x8F, 0x00, 0x00, 0xF7, 0x1F, 0x00, 0x00, 0xFD, 0x0B,
+    0x00, 0x30, 0xFF, 0x0F, 0x00, 0x00, 0xFC, 0x8F, 0x00, 0x00, 0x80, 0xBF, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x50, 0xFF,
+    0x00, 0x00, 0x00, 0xFC, 0x08, 0x50, 0xEF, 0x00, 0x10, 0xDF, 0xCF, 0x00, 0x30, 0xEF, 0x00, 0x00,
+    0xE0, 0xAF, 0x00, 0xF5, 0x3F, 0x00, 0x30, 0xFF, 0x01, 0x00, 0x00, 0xFD, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0x08, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x7F, 0xF1, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xCE, 0xFF, 0x03, 0xF1, 0x0C, 0x00, 0x31, 0x01, 0x00, 0x00, 0x00,
+    0xC0, 0xEF, 0xFF, 0x09, 0x00, 0x00, 0x60, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0x3F, 0x00, 0xE0, 0x07, 0x90, 0x09, 0x70, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x9F, 0x00, 0x00, 0x60, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xC0, 0x4F, 0x00, 0xF0, 0x6F, 0x00,
+    0x00, 0x00, 0xE6, 0x7A, 0x86, 0xFC, 0xDF, 0x00, 0x00, 0x50, 0xFF, 0xFE, 0x69, 0xA6, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x1A, 0x00,
+    0x00, 0x10, 0xFF, 0x07, 0x00, 0x00, 0xFC, 0x9F, 0x00, 0x00, 0x91, 0x19, 0x00, 0x00, 0x91, 0x19,
+    0x00, 0x00, 0x00, 0x83, 0xFE, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFF, 0xEF, 0x49, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x20, 0xFF, 0x38, 0x83, 0xFF, 0x0F, 0x00,
+    0xF8, 0x01, 0x00, 0x30, 0xFF, 0x01, 0x00, 0xFB, 0x09, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x01, 0x00, 0x90, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0x0F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xF9, 0xFF,
+    0xFF, 0xFF, 0x9F, 0x00, 0x90, 0xCF, 0x00, 0x00, 0x00, 0x31, 0x33, 0x33, 0x01, 0x00, 0x00, 0xF9,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00,
+    0x00, 0xF9, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0x09, 0xF1, 0x0E, 0x30, 0xDF, 0x00, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0x09, 0xA0, 0xCF,
+    0x00, 0x90, 0x9F, 0x00, 0x90, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x8F, 0x00, 0x00, 0xF9,
+    0x0C, 0x00, 0x50, 0xFE, 0x1F, 0x90, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x8F, 0x00, 0x00,
+    0xF9, 0x6E, 0x66, 0xA6, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xDF, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x6F,
+    0x00, 0x00, 0xC0, 0xAF, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0xF3, 0x2F, 0x00, 0xF7, 0x07,
+    0xB0, 0x2F, 0x00, 0xF7, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x05, 0x00, 0x00, 0xFC, 0x0E, 0x00,
+    0x00, 0xD0, 0x7F, 0x00, 0x30, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x01, 0x00, 0x00,
+    0xFA, 0x0F, 0x00, 0x20, 0xFF, 0x02, 0x00, 0x00, 0xF0, 0x2F, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00,
+    0x40, 0xFF, 0x01, 0x00, 0x00, 0xF9, 0x0F, 0x00, 0x00, 0xFC, 0x0C, 0x00, 0x00, 0xF3, 0x0F, 0x00,
+    0x00, 0xFC, 0x06, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06, 0xF6, 0x6F, 0x00, 0x00, 0x00,
+    0xFC, 0x06, 0x00, 0x00, 0xFC, 0x0C, 0x00, 0x00, 0xF7, 0x3F, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00,
+    0xFC, 0x0C, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x40, 0xFF, 0x02, 0x00, 0x00, 0xF7, 0x0E, 0x00, 0x00,
+    0xFC, 0x0E, 0x00, 0x00, 0xD0, 0x7F, 0x00, 0x40, 0xFF, 0x01, 0x00, 0x00, 0xFA, 0x0F, 0x00, 0x00,
+    0xFC, 0x0D, 0x00, 0x00, 0x90, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00,
+    0x00, 0xFF, 0x03, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0xFE, 0x05, 0x00, 0x10, 0xFF, 0x01, 0x00,
+    0xFF, 0x01, 0x70, 0x7F, 0xFE, 0x00, 0x70, 0xAF, 0x00, 0x00, 0x30, 0xFF, 0x15, 0xFF, 0x07, 0x00,
+    0x00, 0xFC, 0x07, 0x00, 0x30, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x33, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x05,
+    0x30, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x8C, 0x03, 0x00, 0x00, 0x00, 0x30, 0xB9,
+    0x28, 0x00, 0xFA, 0x03, 0xB1, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xF8, 0x1E, 0xF3, 0x9F, 0x00, 0x00,
+    0xF1, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F,
+    0x00, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x93, 0x99, 0x99, 0xF9, 0x9F, 0x99, 0x99, 0x59,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
+    0x5F, 0x00, 0x00, 0x60, 0xFF, 0x00, 0x00, 0x00, 0xA0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x91, 0x99, 0xFD,
+    0xBF, 0x00, 0x00, 0x00, 0xF7, 0x0A, 0x00, 0xF0, 0x6F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x70,
+    0xFF, 0x08, 0x00, 0x60, 0xFF, 0x5F, 0x00, 0x00, 0xF7, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xBD, 0xFC, 0xBF, 0x01, 0x00, 0x00, 0xFA, 0x4F, 0x00, 0x80,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xCF, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFB, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0xE0, 0x8F, 0x00, 0x00, 0x00,
+    0x30, 0x7F, 0x00, 0x90, 0x7F, 0x00, 0x00, 0xF7, 0x0F, 0x00, 0xF6, 0x04, 0x00, 0x80, 0xBF, 0x00,
+    0x00, 0xF5, 0x0F, 0x00, 0x00, 0x00, 0xF9, 0x9E, 0x99, 0xB9, 0xFE, 0x3E, 0x00, 0x90, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0F, 0x00,
+    0xF9, 0x9E, 0x99, 0x99, 0x99, 0x09, 0x00, 0x00, 0xF9, 0x9E, 0x99, 0x99, 0x59, 0x00, 0x90, 0xCF,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF9, 0x9E, 0x99, 0x99, 0x99, 0xD9, 0x9F,
+    0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9, 0xFF, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0xC0, 0x4F, 0x80,
+    0x7F, 0x00, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0x09, 0x10, 0xFF, 0x05, 0x90, 0x9F, 0x00, 0x90, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x9F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x90,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x9F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA5, 0xFE, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0x60, 0xFF, 0x01, 0x00,
+    0xFA, 0x0C, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xFA, 0x03, 0x70, 0x7F, 0x00, 0xFA, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xF3, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x33, 0x33, 0xFA, 0x07, 0x00, 0x00, 0xFC, 0x08, 0x00, 0x00, 0x80, 0xCF, 0x00, 0x70, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xCF, 0x00, 0x00, 0x00, 0xF5, 0x0F, 0x00, 0x70, 0xCF, 0x00,
+    0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x80, 0xBF, 0x00, 0x00, 0x00, 0xF4,
+    0x0F, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xC0,
+    0x6F, 0x00, 0x00, 0xFC, 0x76, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xFC, 0x07,
+    0x00, 0x00, 0xF6, 0x0F, 0x00, 0x00, 0xC0, 0x5F, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xF0, 0x3F,
+    0x00, 0x80, 0xDF, 0x00, 0x00, 0x00, 0xF1, 0x3F, 0x00, 0x00, 0xFC, 0x08, 0x00, 0x00, 0x80, 0xCF,
+    0x00, 0x80, 0xCF, 0x00, 0x00, 0x00, 0xF5, 0x0F, 0x00, 0x00, 0xFC, 0x08, 0x00, 0x00, 0x70, 0xEF,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xF3,
+    0x0F, 0x00, 0x00, 0xF8, 0x0B, 0x00, 0x80, 0xCF, 0x00, 0x00, 0xFC, 0x05, 0xA0, 0x3F, 0xF8, 0x05,
+    0xB0, 0x7F, 0x00, 0x00, 0x00, 0xF7, 0xDF, 0xBF, 0x00, 0x00, 0x00, 0xF6, 0x0D, 0x00, 0xA0, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x7F, 0x01, 0x00, 0x00, 0x00, 0x30, 0xFC, 0xFF,
+    0xCF, 0x16, 0x00, 0x30, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x01, 0x70, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA5, 0xFE, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x9F, 0x00, 0xFC, 0x68,
+    0xFA, 0x0A, 0x00, 0x10, 0xFF, 0x03, 0x40, 0xFF, 0x09, 0x00, 0xF4, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x99, 0x99, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x60, 0xFF, 0x00,
+    0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0x0A, 0x00, 0x20, 0xEF, 0x01,
+    0x00, 0xF0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x0E, 0x00, 0x40, 0xFF, 0x0C,
+    0x00, 0x00, 0xE0, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3E,
+    0x00, 0x10, 0xFC, 0x0D, 0x00, 0x00, 0xD1, 0xFF, 0xCE, 0xFE, 0xDC, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFE, 0x9F, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x00, 0x60, 0x5F, 0x00, 0xC0, 0x1F, 0x00,
+    0x00, 0xF0, 0x0F, 0x00, 0xF6, 0x06, 0x00, 0xE0, 0x6F, 0x00, 0x00, 0xE0, 0x5F, 0x00, 0x00, 0x00,
+    0xF9, 0x0C, 0x00, 0x00, 0x90, 0xFF, 0x01, 0x90, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x90, 0xEF, 0x00, 0x00, 0x00, 0xC7, 0xCC, 0xFF,
+    0x09, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00,
+    0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9, 0x6C, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0x60, 0xAF, 0xE0, 0x1F, 0x00, 0xFF, 0x06, 0x00, 0x00,
+    0xF9, 0x09, 0x00, 0xF8, 0x0D, 0x90, 0x9F, 0x00, 0x90, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0x7F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCF, 0x28, 0x00, 0x90, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x7F, 0x00, 0x00, 0xF9, 0x9E, 0x99, 0xFB, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xA5, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x00,
+    0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xA0,
+    0xAF, 0x00, 0xFE, 0x00, 0x30, 0xAF, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFE, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0x00, 0xFC, 0x06, 0x00, 0x00, 0x60, 0xDF, 0x00, 0x90, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x9F, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x90, 0xEF, 0xCC, 0xCC, 0xCC, 0xEC, 0x6F, 0x00, 0x00,
+    0xF6, 0x0C, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0xFC, 0x06, 0x00,
+    0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0xFE, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00,
+    0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x90, 0x9F, 0x00, 0x00, 0x00,
+    0xF0, 0x5F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x60, 0xDF, 0x00, 0x90, 0x9F, 0x00, 0x00, 0x00,
+    0xF3, 0x0F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x10, 0xFE, 0xEF, 0x7A, 0x01, 0x00, 0x00, 0x00,
+    0xFC, 0x06, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0xF3, 0x1F, 0x00,
+    0xE0, 0x6F, 0x00, 0x00, 0xF8, 0x0A, 0xE0, 0x0F, 0xF5, 0x08, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0x1E, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0xF1, 0x3F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0xF4, 0xDF, 0xB9, 0xFF, 0xFF, 0xCC, 0xFD, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x99, 0x99, 0xFF, 0x99, 0xD9, 0xAF, 0x99, 0x09, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x97, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x1E, 0x40, 0xBF, 0x00, 0xC0, 0x1F, 0x00, 0x50, 0xEF, 0x00,
+    0x00, 0xF6, 0x9F, 0x00, 0xF9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x62, 0x66, 0x66, 0xF6,
+    0x6F, 0x66, 0x66, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0x0A, 0x00, 0x00, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0x1F, 0x00, 0xB0, 0x5F, 0x00, 0x00, 0xF0, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x30, 0xFF, 0x08, 0x00, 0x00, 0xA0, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0x5F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x05, 0x00, 0x00, 0xF1, 0x5F, 0x00, 0x00,
+    0x00, 0xE8, 0xFF, 0x8E, 0xF0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC3, 0xFF, 0xCF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFC, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0xF6,
+    0x0E, 0x00, 0x00, 0x00, 0x60, 0x3F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0xF7, 0x03,
+    0x00, 0xF5, 0x7F, 0x66, 0x66, 0xC6, 0xBF, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xFE,
+    0x08, 0x70, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0x0E, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x09, 0x00, 0x00, 0xF9, 0x0C, 0x00,
+    0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9,
+    0x0C, 0xF6, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0x09, 0x00, 0xFF, 0xF5, 0x0B, 0x00, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0x09, 0x00, 0xF1, 0x5F, 0x90,
+    0x9F, 0x00, 0x70, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x5F, 0x00, 0x00, 0xF9, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x5F, 0x00, 0x00, 0xF9, 0x0C,
+    0x00, 0x30, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xF0, 0x6F, 0x00, 0x00,
+    0x00, 0xF9, 0x0C, 0x60, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x70, 0xEF, 0x20, 0xCF, 0x00, 0x00, 0xEF,
+    0x20, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xE0, 0x9F, 0xF2, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00,
+    0x00, 0x00, 0x90, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0xAF, 0x67, 0x66, 0xFC, 0x09, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x60,
+    0xFF, 0x00, 0x90, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0x00, 0xF3, 0x0F,
+    0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x90, 0x9F,
+    0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFC,
+    0x06, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06,
+    0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06,
+    0x00, 0x00, 0xF0, 0x3F, 0x00, 0x90, 0x9F, 0x00, 0x00, 0x00, 0xF0, 0x6F, 0x00, 0x00, 0xFC, 0x06,
+    0x00, 0x00, 0x60, 0xFF, 0x00, 0x90, 0x9F, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0xFC, 0x06,
+    0x00, 0x00, 0x00, 0x91, 0xFE, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0xFF,
+    0x03, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0xF4, 0x0E,
+    0xF2, 0x0A, 0xF1, 0x0D, 0xF4, 0x0E, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x80,
+    0xAF, 0x00, 0xF7, 0x0D, 0x00, 0x00, 0x00, 0xF1, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xEB, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x9C, 0x01, 0x00,
+    0x00, 0xC6, 0x03, 0x00, 0x50, 0xFA, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0x06, 0x80, 0x6F, 0x00, 0x70, 0x6F, 0x00, 0x60, 0xCF, 0x00, 0x00, 0x60, 0xFF, 0x19, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x66, 0x66, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x06, 0x00,
+    0x00, 0x20, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x5F,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F,
+    0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x90, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x0F, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xFE, 0xFF, 0x6B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA5, 0xFF, 0xEF, 0x38, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0x60, 0x3F,
+    0x00, 0xE0, 0x0F, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0xFA, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x01, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xFC, 0x0C, 0x30, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0A, 0x00, 0xF9, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0x09, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00,
+    0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9, 0x0C, 0x60, 0xFF, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0x00, 0xFA, 0xFF, 0x05, 0x00,
+    0xFF, 0x06, 0x00, 0x00, 0xF9, 0x09, 0x00, 0x80, 0xEF, 0x90, 0x9F, 0x00, 0x30, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0x1F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0x1F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF5, 0x3F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0x09, 0x00, 0x00, 0x00, 0xF0, 0x6F, 0x00, 0x00, 0x00, 0xF3, 0x2F, 0xC0, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0x72, 0x8F, 0x00, 0x00, 0xFC, 0x72, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x0E, 0x70, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x40, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x01, 0x00,
+    0x00, 0xF9, 0x09, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x60, 0xDF, 0x00, 0x90, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x90, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00,
+    0x00, 0xFC, 0x06, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xC0, 0x6F, 0x00,
+    0x00, 0xFC, 0xA7, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00,
+    0xF6, 0x0C, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x90,
+    0xAF, 0x00, 0x00, 0x00, 0xF0, 0x5F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x60, 0xDF, 0x00, 0x90,
+    0x9F, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x20, 0xB7,
+    0xFF, 0x0D, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xF3, 0x0F, 0x00,
+    0x00, 0x70, 0xDF, 0x00, 0xFA, 0x0A, 0x00, 0x00, 0xF0, 0x2F, 0xF7, 0x07, 0xC0, 0x1F, 0xF8, 0x0A,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x01, 0xFD, 0x07, 0x00, 0x00,
+    0x10, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x33, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x33, 0xA3, 0x7F, 0x33, 0xF6, 0x3B, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x10, 0xCF, 0x00, 0x90, 0x3F, 0x00, 0x60, 0x6F,
+    0x00, 0x60, 0xEF, 0x00, 0x00, 0x00, 0xF6, 0xEF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0x09, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
+    0xF2, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x5F, 0x00, 0xA0, 0xCC, 0xCC, 0xCC, 0xFC,
+    0xEF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x1F, 0x00, 0x00, 0xFD, 0x09, 0x00, 0x00,
+    0xB0, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x09, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x00, 0x00, 0x00,
+    0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xF9, 0xFF, 0xAF, 0x05, 0x00, 0x00, 0x00, 0xC5, 0xCC,
+    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x00, 0x00, 0x00, 0x40, 0xFA, 0xFF, 0xAF, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x62, 0x05, 0x00, 0x00, 0x00, 0x40, 0x7F, 0x00, 0xB0, 0x4F, 0x00, 0x00, 0xF3,
+    0x0F, 0x30, 0xAF, 0x00, 0x10, 0xFF, 0x9A, 0x99, 0x99, 0x99, 0xFE, 0x08, 0x00, 0x00, 0xF9, 0x0C,
+    0x00, 0x00, 0x00, 0xFC, 0x0C, 0x00, 0xFE, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0x0C, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x05, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x09, 0x00,
+    0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9,
+    0x0C, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0xF6, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0x09, 0x00, 0xF4, 0xEF, 0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0x09,
+    0x00, 0x00, 0xFE, 0x97, 0x9F, 0x00, 0x00, 0xFE, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0C, 0x00,
+    0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0C,
+    0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xD0, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x0B, 0x00, 0x00, 0x00,
+    0xF2, 0x4F, 0x00, 0x00, 0x00, 0xD0, 0x8F, 0xF1, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xA7,
+    0x4F, 0x00, 0x00, 0xF8, 0xA7, 0xAF, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x04, 0x00, 0xFC, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAF, 0x00, 0x00, 0x00, 0xFD, 0x09, 0x00, 0x00, 0xFC,
+    0x08, 0x00, 0x00, 0x80, 0xBF, 0x00, 0x70, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xCF, 0x00,
+    0x00, 0x00, 0xF5, 0x0F, 0x00, 0x70, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0C,
+    0x00, 0x00, 0x70, 0xDF, 0x00, 0x00, 0x00, 0xF6, 0x0F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF0,
+    0x3F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06, 0xF9, 0x3F, 0x00,
+    0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0xC0, 0x6F,
+    0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x70, 0xDF, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0x00, 0x00, 0xFC, 0x08, 0x00, 0x00, 0x80, 0xBF, 0x00, 0x70, 0xCF, 0x00, 0x00, 0x00, 0xF5, 0x0F,
+    0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0xFC, 0x06,
+    0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0x10, 0xFF, 0x03, 0xFF, 0x04,
+    0x00, 0x00, 0xB0, 0x7F, 0xFB, 0x02, 0x80, 0x5F, 0xFC, 0x05, 0x00, 0x00, 0x10, 0xFE, 0x78, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0xFC, 0x37, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0x1F, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF0, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0x3F, 0x00, 0x80, 0x5F, 0x00, 0x70, 0x6F, 0x00, 0x30, 0xFF, 0x05, 0x00, 0x00,
+    0x60, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0D, 0x00, 0x00, 0xF8, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0x0E, 0x00, 0x00, 0xF8, 0x0E, 0x00, 0x00, 0xF1, 0x7F, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x04, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA5, 0xFF, 0xEF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x91, 0xFE, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xAF, 0x00, 0x50, 0xEF, 0x01, 0x10, 0xFC, 0x0F, 0xE3, 0x1E, 0x00, 0x70, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0xF7, 0x0E, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x10, 0xFF, 0x08, 0x00,
+    0xF6, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF4, 0xCF,
+    0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x09, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00,
+    0x90, 0x9F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9, 0x0C, 0x00,
+    0x60, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0x00,
+    0x80, 0x69, 0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0x09, 0x00, 0x00, 0xF7, 0xAE, 0x9F, 0x00,
+    0x00, 0xF7, 0x6F, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x05, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0x6F, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x05, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00,
+    0x50, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x70,
+    0xEF, 0xF8, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xEA, 0x0F, 0x00, 0x00, 0xF4, 0xEA, 0x7F,
+    0x00, 0x00, 0x00, 0xE0, 0x9F, 0x00, 0x00, 0xF2, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0x05, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xAF, 0x00, 0x00, 0x30, 0xFF, 0x09, 0x00, 0x00, 0xFC, 0x0E, 0x00, 0x00, 0xE0, 0x7F, 0x00,
+    0x10, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x02, 0x00, 0x00, 0xFB, 0x0F, 0x00, 0x10,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x10, 0xFF, 0x04, 0x00,
+    0x00, 0xFD, 0x0F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x06, 0x00,
+    0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06, 0x90, 0xFF, 0x03, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00,
+    0xFC, 0x06, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00,
+    0xF0, 0x3F, 0x00, 0x30, 0xFF, 0x03, 0x00, 0x00, 0xF8, 0x0E, 0x00, 0x00, 0xFC, 0x0E, 0x00, 0x00,
+    0xE0, 0x7F, 0x00, 0x30, 0xFF, 0x02, 0x00, 0x00, 0xFB, 0x0F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x5F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00,
+    0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0xFA, 0x69, 0xEF, 0x00, 0x00, 0x00, 0x70, 0xAF, 0xEF, 0x00,
+    0x40, 0xBF, 0xFF, 0x01, 0x00, 0x00, 0xB0, 0xCF, 0x00, 0xFB, 0x0C, 0x00, 0x00, 0x00, 0xF5, 0xAD,
+    0x9F, 0x00, 0x00, 0x00, 0xFA, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0D, 0x00, 0xFB, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x6D, 0x00, 0xF0, 0x13, 0xFB, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x09, 0x00, 0x50,
+    0x9F, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xFB, 0x5F, 0x00, 0x00, 0xA1, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0F, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0xF2, 0x7F, 0x00, 0x30, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x17, 0x00, 0x00, 0x50, 0xFF, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x6F, 0x00, 0x00, 0x20, 0x17, 0x00, 0x00, 0xA1, 0xFF, 0x07, 0x00, 0x00,
+    0xF1, 0x9F, 0x00, 0x00, 0xFA, 0x1F, 0x00, 0x00, 0x00, 0xA0, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x1E, 0x00, 0x00, 0xFA, 0x2F, 0x00, 0x00, 0x22, 0x00, 0x00, 0xC2, 0xDF, 0x00, 0x00, 0x00,
+    0xF3, 0x3F, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFC, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xCF, 0x17, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x01, 0x00,
+    0xFA, 0xCF, 0xFC, 0xBE, 0xDF, 0xEF, 0x03, 0x00, 0xE0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x4F,
+    0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xC4, 0xFF, 0x03, 0x00, 0xB0, 0xFF, 0x18, 0x00, 0x00, 0x70,
+    0x6F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x10, 0xA4, 0xFF, 0x1E, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x18, 0x00, 0x00,
+    0x10, 0xFE, 0x09, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0xF9, 0x0C,
+    0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0xF6, 0xCF, 0x00, 0x00, 0x00,
+    0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x06,
+    0x00, 0x00, 0xF9, 0x09, 0x00, 0x00, 0xE0, 0xFF, 0x9F, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00,
+    0xF8, 0xAF, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00,
+    0x00, 0xF8, 0x9F, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xFD, 0x0C, 0x00, 0x60, 0x5C,
+    0x00, 0x00, 0x00, 0xF9, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xCF, 0x01, 0x00, 0x40, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0x0C, 0x00, 0x00, 0xF0, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xF9, 0x0E, 0x00,
+    0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x0A, 0x00, 0x00, 0x00,
+    0xC0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xEF, 0x01, 0x00, 0xE1, 0xFF,
+    0x09, 0x00, 0x00, 0xFC, 0x9F, 0x00, 0x00, 0xF9, 0x1F, 0x00, 0x00, 0xFA, 0x3E, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0xFC, 0x0C, 0x00, 0x60, 0xFF, 0x0F, 0x00, 0x00, 0xFA, 0x3E, 0x00, 0x00, 0x10, 0x07,
+    0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0xFA, 0x3E, 0x00, 0xA0, 0xFF, 0x0F, 0x00, 0x00, 0xFC,
+    0x06, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC,
+    0x06, 0x00, 0xF9, 0x3F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF6, 0x0C,
+    0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x1D,
+    0x00, 0x30, 0xFF, 0x07, 0x00, 0x00, 0xFC, 0x9F, 0x00, 0x00, 0xF9, 0x1F, 0x00, 0x00, 0xFC, 0x0C,
+    0x00, 0x60, 0xFF, 0x0F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0xF3, 0x2F,
+    0x00, 0x00, 0xF8, 0x0B, 0x00, 0x00, 0x00, 0xF8, 0x0D, 0x00, 0x50, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0xF5, 0xCE, 0x8F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xAF, 0x00, 0x00, 0xFF, 0xDF, 0x00, 0x00, 0x00,
+    0xF7, 0x1F, 0x00, 0xE1, 0x8F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x80, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0x08, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCF, 0xFA, 0xFD,
+    0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0xFE, 0x37, 0xF7, 0x0C, 0x00, 0x00,
+    0xD1, 0xFF, 0x9D, 0xB9, 0xFF, 0x8E, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0x0F, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x9C, 0xFA, 0xCF, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C,
+    0x00, 0x30, 0xFF, 0xAD, 0xB9, 0xFE, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x6F, 0x00,
+    0x00, 0x30, 0xFF, 0xAD, 0xC9, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x9D, 0xE9, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0xF1, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x9A, 0xE9, 0xFF, 0x08,
+    0x00, 0x00, 0xF6, 0xAE, 0xC9, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0xF3, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x0A, 0x00, 0x70, 0xFD, 0xAE, 0x91, 0xBE, 0x06,
+    0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xAF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x9C, 0xC9, 0xFF, 0x5F, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF9, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x9C, 0xA9, 0xFD, 0xFF, 0x05, 0x00, 0x00, 0xF9,
+    0x0C, 0x00, 0x00, 0x00, 0x90, 0x9F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00,
+    0x00, 0xF9, 0x0C, 0x00, 0x00, 0x60, 0xFF, 0x0C, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x00, 0xF9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0x09, 0x00, 0x00,
+    0x50, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xFC, 0xEF, 0x9A, 0xEA, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF9,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xEF, 0x9A, 0xEA, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF5, 0x3F, 0x00, 0x60, 0xFF, 0xCF, 0x99, 0xEA, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xBF, 0x99, 0xFD, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x08, 0x00,
+    0x00, 0xC0, 0xFF, 0x0E, 0x00, 0x00, 0x40, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0x00, 0x00,
+    0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x0E, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x8E, 0xA6, 0xEF, 0xFB, 0x09, 0x00, 0x00, 0xFC, 0xFB, 0x8D,
+    0xC7, 0xFF, 0x05, 0x00, 0x00, 0xC0, 0xFF, 0x8B, 0xA8, 0xCE, 0x00, 0x00, 0xF2, 0xEF, 0x78, 0xFA,
+    0xFC, 0x0F, 0x00, 0x00, 0xC0, 0xFF, 0x9B, 0x97, 0xFC, 0x0F, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00,
+    0x00, 0xC0, 0xFF, 0xCE, 0xFF, 0xF8, 0x0F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF0, 0x3F, 0x00,
+    0x00, 0xFC, 0x06, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x90, 0xFF, 0x03, 0x00,
+    0xFC, 0x06, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00,
+    0xFC, 0x06, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xE1, 0xEF, 0x89, 0xFA, 0xCF, 0x00, 0x00, 0x00,
+    0xFC, 0xFB, 0x8D, 0xC7, 0xFF, 0x05, 0x00, 0x00, 0xF2, 0xEF, 0x78, 0xFA, 0xFC, 0x0F, 0x00, 0x00,
+    0xFC, 0x06, 0x00, 0x00, 0x90, 0xDF, 0x79, 0xA7, 0xFF, 0x0A, 0x00, 0x00, 0xF3, 0xEF, 0xCC, 0x0A,
+    0x00, 0xF1, 0xEF, 0x99, 0xFC, 0xFB, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0x5F, 0x00, 0x00, 0xFB, 0x8F, 0x00, 0x00, 0x30, 0xFF, 0x05, 0x00, 0x30, 0xFF, 0x05,
+    0x00, 0x00, 0x80, 0xFF, 0x0C, 0x00, 0x00, 0xF0, 0xEF, 0xCC, 0xCC, 0xCC, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x05, 0x30,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xEB, 0xFF, 0xCF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x5F, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x8E, 0x00,
+    0xF6, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xAF, 0x00, 0x00, 0x00, 0x50, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0F, 0x00, 0xF1, 0x0D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x10, 0xFA, 0xFF, 0xFF, 0xEF,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x6F, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xEF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xFC, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xAF,
+    0x01, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0xF5, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0x01, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x9D, 0x02, 0x00, 0x00, 0x00, 0x50,
+    0xFC, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xDF, 0x7B, 0x02, 0x00, 0x00, 0x00,
+    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFB, 0xFF, 0xFF, 0xEF, 0x18, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x90, 0x9F,
+    0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xF9, 0x0B, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00,
+    0xF6, 0xCF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF9, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0x09, 0x00, 0x00, 0x00, 0xFD, 0x9F, 0x00, 0x00, 0x00,
+    0x70, 0xFE, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFE, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0x00, 0x00, 0x00, 0xD0,
+    0xCF, 0x00, 0x10, 0xD8, 0xFF, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xEF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x04, 0x00, 0x00, 0x80, 0xFF, 0x0A, 0x00, 0x00,
+    0xE0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x5F, 0x00, 0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0x4F, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1,
+    0xFF, 0xFF, 0x1C, 0xF9, 0x09, 0x00, 0x00, 0xFC, 0x56, 0xFE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0x8F, 0xF3, 0x0F, 0x00, 0x00, 0x00, 0xE8,
+    0xFF, 0xFF, 0xEF, 0x08, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0x3B, 0xF3,
+    0x0F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xC0,
+    0x6F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF8, 0x6F, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xFC, 0x06,
+    0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0xF0, 0x3F,
+    0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFC, 0x56, 0xFE, 0xFF, 0x5E, 0x00,
+    0x00, 0x00, 0x30, 0xFD, 0xFF, 0x8F, 0xF3, 0x0F, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x60, 0xFE,
+    0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x50, 0xFB, 0xFF, 0x0C, 0x00, 0x30, 0xFE, 0xFF, 0x7F, 0xF3,
+    0x0F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x1F, 0x00, 0x00, 0xF7,
+    0x5F, 0x00, 0x00, 0xE0, 0xAF, 0x00, 0x00, 0x00, 0xF7, 0x1E, 0x00, 0x00, 0x10, 0xFF, 0x06, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x63,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x63, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x46, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x52, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x63, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x35, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x36, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x64, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x64, 0xF8, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x65,
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+    0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x70, 0x8F, 0x00, 0x00, 0x00, 0xC0, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x35, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x46, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x36, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x64, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x46, 0x01,
+    0xF3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x35, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x08, 0x00,
+    0x00, 0xF2, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xCF, 0x03, 0x00, 0x00, 0x20, 0xFA, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9A, 0x09,
+    0x00, 0x00, 0x00, 0x10, 0xEF, 0x00, 0x00, 0x95, 0xE9, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x1F, 0x00, 0x00, 0xFB, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xEF, 0x9A, 0x99, 0xFD, 0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xC5, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00,
+    0x00, 0xF9, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0xA1, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xCD, 0x02, 0x00, 0x00, 0xF0,
+    0x0F, 0x00, 0x00, 0xC0, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x13, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE8, 0xFF, 0xFF, 0x9E,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x33, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xEF, 0xDC, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xDC, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC8, 0xFD, 0x03, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0xCE, 0x29,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x8C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xEC, 0xFF,
+    0x9E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x8E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+};
+
+static const font_glyph_t font_sans24_glyphs[] = {
+    {0, 8, 0, 8}, // ' '
+    {8, 10, 0, 10}, // '!'
+    {18, 12, 0, 11}, // '"'
+    {30, 20, 0, 20}, // '#'
+    {50, 16, 0, 15}, // '$'
+    {66, 24, 0, 23}, // '%'
+    {90, 20, 0, 19}, // '&'
+    {110, 8, 0, 7}, // '''
+    {118, 10, 0, 9}, // '('
+    {128, 10, 0, 9}, // ')'
+    {138, 12, 0, 12}, // '*'
+    {150, 20, 0, 20}, // '+'
+    {170, 8, 0, 8}, // ','
+    {178, 10, 0, 9}, // '-'
+    {188, 8, 0, 8}, // '.'
+    {196, 10, 0, 8}, // '/'
+    {206, 16, 0, 15}, // '0'
+    {222, 16, 0, 15}, // '1'
+    {238, 16, 0, 15}, // '2'
+    {254, 16, 0, 15}, // '3'
+    {270, 16, 0, 15}, // '4'
+    {286, 16, 0, 15}, // '5'
+    {302, 16, 0, 15}, // '6'
+    {318, 16, 0, 15}, // '7'
+    {334, 16, 0, 15}, // '8'
+    {350, 16, 0, 15}, // '9'
+    {366, 8, 0, 8}, // ':'
+    {374, 8, 0, 8}, // ';'
+    {382, 20, 0, 20}, // '<'
+    {402, 20, 0, 20}, // '='
+    {422, 20, 0, 20}, // '>'
+    {442, 14, 0, 13}, // '?'
+    {456, 24, 0, 24}, // '@'
+    {480, 18, 0, 16}, // 'A'
+    {498, 16, 0, 16}, // 'B'
+    {514, 18, 0, 17}, // 'C'
+    {532, 18, 0, 18}, // 'D'
+    {550, 16, 0, 15}, // 'E'
+    {566, 14, 0, 14}, // 'F'
+    {580, 20, 0, 19}, // 'G'
+    {600, 18, 0, 18}, // 'H'
+    {618, 8, 0, 7}, // 'I'
+    {626, 10, -2, 7}, // 'J'
+    {636, 18, 0, 16}, // 'K'
+    {654, 14, 0, 13}, // 'L'
+    {668, 22, 0, 21}, // 'M'
+    {690, 18, 0, 18}, // 'N'
+    {708, 20, 0, 19}, // 'O'
+    {728, 14, 0, 14}, // 'P'
+    {742, 20, 0, 19}, // 'Q'
+    {762, 18, 0, 17}, // 'R'
+    {780, 16, 0, 15}, // 'S'
+    {796, 16, -1, 15}, // 'T'
+    {812, 18, 0, 18}, // 'U'
+    {830, 18, 0, 16}, // 'V'
+    {848, 24, 0, 24}, // 'W'
+    {872, 16, 0, 16}, // 'X'
+    {888, 16, -1, 15}, // 'Y'
+    {904, 16, 0, 16}, // 'Z'
+    {920, 10, 0, 9}, // '['
+    {930, 10, 0, 8}, // '\'
+    {940, 10, 0, 9}, // ']'
+    {950, 20, 0, 20}, // '^'
+    {970, 14, -1, 12}, // '_'
+    {984, 12, 0, 12}, // '`'
+    {996, 16, 0, 15}, // 'a'
+    {1012, 16, 0, 15}, // 'b'
+    {1028, 14, 0, 13}, // 'c'
+    {1042, 16, 0, 15}, // 'd'
+    {1058, 16, 0, 15}, // 'e'
+    {1074, 10, 0, 8}, // 'f'
+    {1084, 16, 0, 15}, // 'g'
+    {1100, 16, 0, 15}, // 'h'
+    {1116, 8, 0, 7}, // 'i'
+    {1124, 8, -1, 7}, // 'j'
+    {1132, 14, 0, 14}, // 'k'
+    {1146, 8, 0, 7}, // 'l'
+    {1154, 24, 0, 23}, // 'm'
+    {1178, 16, 0, 15}, // 'n'
+    {1194, 16, 0, 15}, // 'o'
+    {1210, 16, 0, 15}, // 'p'
+    {1226, 16, 0, 15}, // 'q'
+    {1242, 10, 0, 10}, // 'r'
+    {1252, 14, 0, 13}, // 's'
+    {1266, 10, 0, 9}, // 't'
+    {1276, 16, 0, 15}, // 'u'
+    {1292, 14, 0, 14}, // 'v'
+    {1306, 20, 0, 20}, // 'w'
+    {1326, 14, 0, 14}, // 'x'
+    {1340, 14, 0, 14}, // 'y'
+    {1354, 14, 0, 13}, // 'z'
+    {1368, 16, 0, 15}, // '{'
+    {1384, 8, 0, 8}, // '|'
+    {1392, 16, 0, 15}, // '}'
+    {1408, 20, 0, 20}, // '~'
+};
+
+static const font_t font_sans24 = {
+    .format = GFX_FORMAT_A4,
+    .height = 29,
+    .atlas_width = 1428,
+    .first_char = 32,
+    .glyph_count = 95,
+    .glyphs = font_sans24_glyphs,
+    .atlas = font_sans24_atlas,
+};
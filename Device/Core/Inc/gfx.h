@@ -0,0 +1,67 @@
+#ifndef __GFX_H__
+#define __GFX_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Constants -----------------------------------------------------------------------------------------------------------
+
+#define GFX_QUEUE_LENGTH 8 // DMA2D jobs waiting to run, submitting to a full queue waits for a free slot
+
+// Types ---------------------------------------------------------------------------------------------------------------
+
+// Asynchronous DMA2D engine. Jobs run one at a time in submission order from the DMA2D interrupt, and each job can
+// have a completion callback, which is called from that interrupt (or straight away when there is nothing for DMA2D
+// to do). CPU code that touches memory a job may be writing calls gfx_wait() first. Jobs clean the D-cache over what
+// they read before they are queued and invalidate what they wrote before their callback.
+
+typedef void (*gfx_callback_t)(void *context);
+
+typedef enum {
+    GFX_FORMAT_ARGB8888,
+    GFX_FORMAT_RGB565,
+    GFX_FORMAT_L8,       // Source only, expanded through a CLUT
+    GFX_FORMAT_L4,       // Source only, two pixels per byte with the first one in the low nibble
+    GFX_FORMAT_ARGB4444, // Source only
+    GFX_FORMAT_A8,       // Source only, alpha with the colour given to gfx_blend()
+    GFX_FORMAT_A4,       // Source only, like A8 with the first pixel in the low nibble
+} gfx_format_t;
+
+// Macros --------------------------------------------------------------------------------------------------------------
+
+// Widens an RGB565 colour to opaque ARGB8888 the way LTDC and DMA2D do, repeating each channel's top bits below it
+#define GFX_RGB565_TO_ARGB8888(color)                                                                                  \
+    (0xFF000000u | GFX_WIDEN_5((color) >> 11 & 0x1Fu) << 16 | GFX_WIDEN_6((color) >> 5 & 0x3Fu) << 8 |                 \
+     GFX_WIDEN_5((color) & 0x1Fu))
+#define GFX_WIDEN_5(value) ((value) << 3 | (value) >> 2)
+#define GFX_WIDEN_6(value) ((value) << 2 | (value) >> 4)
+
+// API -----------------------------------------------------------------------------------------------------------------
+
+// color is in the destination format, RGB565 or ARGB8888
+bool gfx_fill(void *dest, uint16_t width, uint16_t height, uint16_t pitch, gfx_format_t format, uint32_t color,
+              gfx_callback_t callback, void *context);
+bool gfx_fill_bytes(void *dest, size_t size, uint8_t value, gfx_callback_t callback, void *context);
+bool gfx_copy(void *dest, uint16_t dest_pitch, const void *src, uint16_t src_pitch, uint16_t width, uint16_t height,
+              gfx_format_t format, gfx_callback_t callback, void *context);
+bool gfx_convert(void *dest, uint16_t dest_pitch, gfx_format_t dest_format, const void *src, uint16_t src_pitch,
+                 gfx_format_t src_format, uint16_t width, uint16_t height, const uint32_t *clut, uint16_t clut_entries,
+                 gfx_callback_t callback, void *context);
+// Blends src over dest in place. color (ARGB8888) colours A8/A4 sources, and its alpha scales every source.
+bool gfx_blend(void *dest, uint16_t dest_pitch, gfx_format_t dest_format, const void *src, uint16_t src_pitch,
+               gfx_format_t src_format, uint16_t width, uint16_t height, uint32_t color, gfx_callback_t callback,
+               void *context);
+bool gfx_sync(gfx_callback_t callback, void *context); // Callback once every job submitted before it has finished
+bool gfx_busy(void);
+void gfx_wait(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __GFX_H__
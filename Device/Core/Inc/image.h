@@ -5,6 +5,8 @@
 extern "C" {
 #endif
 
+#include "gfx.h"
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -13,16 +15,37 @@ extern "C" {
 #define IMAGE_HEIGHT 272
 #define IMAGE_PIXEL_COUNT (IMAGE_WIDTH * IMAGE_HEIGHT)
 #define IMAGE_DATA_SIZE (IMAGE_PIXEL_COUNT * sizeof(uint16_t))
+#define IMAGE_PALETTE_MAX_ENTRIES 256
+#define IMAGE_SLOT_COUNT 24 // Preloaded full-screen images in SDRAM, leaving room for the other SDRAM buffers
+
+// Indexed pixel formats expanded to RGB565 through the palette
+typedef enum {
+    IMAGE_FORMAT_L8, // One byte per pixel
+    IMAGE_FORMAT_L4, // Two pixels per byte, the first one in the low nibble
+} image_format_t;
 
 // Function declarations
 void display_init(void);
 void display_image(const uint16_t *image_data, size_t data_size);
-void display_default_image();
+void display_default_image(gfx_callback_t callback, void *context);
 
 // New API functions
-uint8_t *get_image_buffer(void);
+uint8_t *get_image_buffer(size_t size); // For CPU writes of the first size bytes of the next frame
+uint16_t *get_draw_buffer(void);
 void clear_image_buffer(void);
 void update_display(void);
+void fill_image_rect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color);
+void display_region(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *data);
+void copy_image_region(uint16_t src_x, uint16_t src_y, uint16_t width, uint16_t height, uint16_t dest_x,
+                       uint16_t dest_y);
+uint8_t *get_index_buffer(void);
+void set_image_palette(const uint8_t *rgb888, size_t entries);
+void display_indexed(image_format_t format);
+uint8_t *get_slot_buffer(uint32_t slot);
+void set_slot_stored(uint32_t slot);
+bool show_slot(uint32_t slot);
+bool is_slot_stored(uint32_t slot);
+bool show_slot_from_isr(uint32_t slot); // Skips the switch when the previous one has not landed yet
 
 #ifdef __cplusplus
 }
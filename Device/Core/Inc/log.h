@@ -0,0 +1,132 @@
+#ifndef __LOG_H__
+#define __LOG_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Constants -----------------------------------------------------------------------------------------------------------
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO // Set per build type in CMakeLists.txt
+#endif
+
+#ifndef LOG_TRACE
+#define LOG_TRACE 0 // 1 sends binary trace records instead of text, set by the LOG_TRACE option in CMakeLists.txt
+#endif
+
+#define LOG_BUFFER_SIZE 4096 // Ring drained by USART1 DMA, about 350 ms of output at 115200 baud
+#define LOG_LINE_MAX 160     // Longest formatted line, longer ones are cut short
+
+#define LOG_TRACE_SYNC 0xA5      // First byte of every trace record
+#define LOG_TRACE_RECORD_MAX 257 // Sync and length bytes plus up to 255 more
+#define LOG_TRACE_STRING_MAX 32  // Longest %s argument, longer ones are cut short
+
+// Types ---------------------------------------------------------------------------------------------------------------
+
+// Debug output on USART1. Messages are formatted into a ring buffer that DMA drains in the background, so logging
+// never waits for the UART. Writers only ever claim and publish space with atomic operations, which makes logging
+// safe from any interrupt, and a message that does not fit is dropped whole and counted. Calls above LOG_LEVEL are
+// still type-checked but compile to nothing.
+//
+// With LOG_TRACE the device does no formatting at all. Each call site's format string goes into .log_strings, which
+// stays in the ELF but is never loaded, and the record carries only its offset there and the raw arguments:
+//
+//   sync (0xA5), length of the rest (1 byte), format offset (2 bytes, little-endian), HAL tick in ms (varint),
+//   then per argument: integers as LEB128 varints, %s as a length byte and the characters, %f as a 32-bit float
+//
+// `host trace` looks the formats up in the ELF and prints the lines.
+
+typedef struct {
+    uint8_t data[LOG_TRACE_RECORD_MAX];
+    size_t length;
+} log_record_t;
+
+// Macros --------------------------------------------------------------------------------------------------------------
+
+#if LOG_TRACE
+#define LOG_EMIT(...) LOG_RECORD(LOG_COUNT(__VA_ARGS__), __VA_ARGS__)
+#else
+#define LOG_EMIT(...) log_printf(__VA_ARGS__)
+#endif
+
+#define LOG_AT(level, ...)                                                                                             \
+    do {                                                                                                               \
+        if (LOG_LEVEL >= (level)) {                                                                                    \
+            LOG_EMIT(__VA_ARGS__);                                                                                     \
+        }                                                                                                              \
+    } while (0)
+
+#define LOG_ERROR(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_WARN(...) LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_INFO(...) LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+
+// The format is still checked against the arguments by a log_printf() call that is never made
+#define LOG_RECORD(count, ...)                                                                                         \
+    do {                                                                                                               \
+        static const char log_format[] __attribute__((section(".log_strings"), used)) = LOG_FIRST(__VA_ARGS__, ~);   \
+        log_record_t log_record;                                                                                       \
+        if (0) {                                                                                                       \
+            log_printf(__VA_ARGS__);                                                                                   \
+        }                                                                                                              \
+        log_record_begin(&log_record, log_format);                                                                     \
+        LOG_CONCAT(LOG_ARGS_, count)(&log_record, __VA_ARGS__)                                                         \
+        log_record_end(&log_record);                                                                                   \
+    } while (0)
+
+#define LOG_FIRST(first, ...) first
+#define LOG_CONCAT(a, b) LOG_CONCAT_(a, b)
+#define LOG_CONCAT_(a, b) a##b
+
+// Arguments after the format, up to eight
+#define LOG_COUNT(...) LOG_COUNT_(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0, ~)
+#define LOG_COUNT_(format, a, b, c, d, e, f, g, h, count, ...) count
+
+#define LOG_ARG(record, value)                                                                                         \
+    _Generic((value),                                                                                                  \
+        char *: log_arg_string,                                                                                        \
+        const char *: log_arg_string,                                                                                  \
+        float: log_arg_float,                                                                                          \
+        double: log_arg_float,                                                                                         \
+        default: log_arg_word)(record, value);
+
+#define LOG_ARGS_0(r, format)
+#define LOG_ARGS_1(r, format, a) LOG_ARG(r, a)
+#define LOG_ARGS_2(r, format, a, b) LOG_ARG(r, a) LOG_ARG(r, b)
+#define LOG_ARGS_3(r, format, a, b, c) LOG_ARG(r, a) LOG_ARG(r, b) LOG_ARG(r, c)
+#define LOG_ARGS_4(r, format, a, b, c, d) LOG_ARGS_3(r, format, a, b, c) LOG_ARG(r, d)
+#define LOG_ARGS_5(r, format, a, b, c, d, e) LOG_ARGS_4(r, format, a, b, c, d) LOG_ARG(r, e)
+#define LOG_ARGS_6(r, format, a, b, c, d, e, f) LOG_ARGS_5(r, format, a, b, c, d, e) LOG_ARG(r, f)
+#define LOG_ARGS_7(r, format, a, b, c, d, e, f, g) LOG_ARGS_6(r, format, a, b, c, d, e, f) LOG_ARG(r, g)
+#define LOG_ARGS_8(r, format, a, b, c, d, e, f, g, h) LOG_ARGS_7(r, format, a, b, c, d, e, f, g) LOG_ARG(r, h)
+
+// API -----------------------------------------------------------------------------------------------------------------
+
+void log_init(void); // After USART1, messages logged before it are held back until then
+void log_printf(const char *format, ...) __attribute__((format(printf, 1, 2)));
+size_t log_write(const char *data, size_t length); // All of data or nothing, returns the bytes queued
+uint32_t log_dropped(void);                        // Messages dropped since boot because the ring was full
+void log_tx_complete(void);                        // USART1 transmit complete or error callback
+
+// Trace records, built by LOG_RECORD() and sent whole like any other message
+void log_record_begin(log_record_t *record, const char *format);
+void log_arg_word(log_record_t *record, uint32_t value);
+void log_arg_float(log_record_t *record, double value);
+void log_arg_string(log_record_t *record, const char *value);
+void log_record_end(log_record_t *record);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __LOG_H__
@@ -0,0 +1,40 @@
+#ifndef __OVERLAY_H__
+#define __OVERLAY_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Constants -----------------------------------------------------------------------------------------------------------
+
+#define OVERLAY_BUFFER_SIZE (480 * 272) // Bytes per overlay buffer, half a screen of RGB565
+
+// Types ---------------------------------------------------------------------------------------------------------------
+
+// Overlay on LTDC layer 1, composited by LTDC over the frame on layer 0. Moving the overlay and changing its alpha or
+// colour key only rewrite layer registers, and every change lands at the next vertical blanking. A new image is
+// written to a second buffer while the current one stays on screen.
+
+typedef enum {
+    OVERLAY_FORMAT_RGB565,
+    OVERLAY_FORMAT_ARGB8888, // Per-pixel alpha
+} overlay_format_t;
+
+// API -----------------------------------------------------------------------------------------------------------------
+
+size_t overlay_image_size(uint16_t width, uint16_t height, overlay_format_t format);
+uint8_t *overlay_begin_upload(uint16_t x, uint16_t y, uint16_t width, uint16_t height, overlay_format_t format);
+void overlay_commit_upload(void);
+bool overlay_move(uint16_t x, uint16_t y);
+void overlay_set_alpha(uint8_t alpha);
+void overlay_set_color_key(bool enabled, uint16_t color);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __OVERLAY_H__
@@ -0,0 +1,37 @@
+#ifndef __PLAYBACK_H__
+#define __PLAYBACK_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Constants -----------------------------------------------------------------------------------------------------------
+
+#define PLAYBACK_MAX_FRAMES 64 // Entries in a sequence, a slot can appear more than once
+#define PLAYBACK_MAX_FPS 60    // The LCD refreshes at about 60 Hz, faster sequences would only drop frames
+#define PLAYBACK_TICK_HZ 10000 // TIM7 counter clock, frame periods are whole ticks
+
+// Types ---------------------------------------------------------------------------------------------------------------
+
+// Animations played from preloaded image slots. TIM7 interrupts at the frame rate and points LTDC at the next slot,
+// which it takes at the following vertical blanking, so a running animation needs neither the UART nor the main
+// loop. A frame the display has not taken yet holds the sequence back a tick. Anything else that changes the screen
+// or rewrites a slot stops playback first, and a sequence that does not loop stays on its last frame.
+
+// API -----------------------------------------------------------------------------------------------------------------
+
+void playback_init(void);
+bool playback_start(const uint8_t *slots, size_t count, uint32_t fps, bool loop);
+void playback_stop(void);
+bool playback_is_playing(void);
+void playback_tick(void); // TIM7 update interrupt
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __PLAYBACK_H__
@@ -0,0 +1,33 @@
+#ifndef __PLOT_H__
+#define __PLOT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Constants -----------------------------------------------------------------------------------------------------------
+
+#define PLOT_MAX_COUNT 8     // Plot IDs are 0 to PLOT_MAX_COUNT - 1
+#define PLOT_MAX_SAMPLES 480 // Samples in one append, a full-width plot's worth
+
+// Types ---------------------------------------------------------------------------------------------------------------
+
+// Scrolling time-series plots drawn into the back buffer. Each sample is one column: appending scrolls the plot left
+// by the number of new samples with a DMA2D copy from the frame on screen, then fills only the new columns, joining
+// each sample to the one before it with a vertical line. Samples outside the plot's range are clamped to its edges.
+
+// API -----------------------------------------------------------------------------------------------------------------
+
+bool plot_create(uint32_t id, uint16_t x, uint16_t y, uint16_t width, uint16_t height, int32_t min, int32_t max,
+                 uint16_t color, uint16_t background);
+bool plot_append(uint32_t id, const int32_t *samples, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __PLOT_H__
@@ -0,0 +1,61 @@
+#ifndef __PROFILE_H__
+#define __PROFILE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// Constants -----------------------------------------------------------------------------------------------------------
+
+#define PROFILE_BUCKET_COUNT 32 // Bucket n counts durations of 2^n to 2^(n+1) - 1 cycles, bucket 0 also holds 0
+
+// Types ---------------------------------------------------------------------------------------------------------------
+
+// Cycle-accurate timing of the message pipeline from the DWT cycle counter, which runs at HCLK. A probe covers the
+// rest of the scope it is declared in and adds the cycles it saw to its stage's histogram when the scope ends, however
+// it ends. Stages nest, so each one's time includes that of the stages it calls. Probes are only used from the main
+// loop, which leaves the histograms free of locking.
+
+typedef enum {
+    PROFILE_STAGE_MESSAGE,  // USART6_Process_Message() calls that had something to read
+    PROFILE_STAGE_RPC,      // process_cbor_rpc_message(): parse and dispatch of a buffered message
+    PROFILE_STAGE_HANDLER,  // The method handler alone
+    PROFILE_STAGE_DISPLAY,  // update_display(): queueing the buffer swap behind the frame's DMA2D jobs
+    PROFILE_STAGE_RESPONSE, // Encoding and queueing a response, including any wait for a free slot
+    PROFILE_STAGE_COUNT,
+} profile_stage_t;
+
+typedef struct {
+    uint32_t count;
+    uint64_t total; // Cycles
+    uint32_t min;
+    uint32_t max;
+    uint32_t buckets[PROFILE_BUCKET_COUNT];
+} profile_histogram_t;
+
+typedef struct {
+    profile_stage_t stage;
+    uint32_t start;
+} profile_probe_t;
+
+// Macros --------------------------------------------------------------------------------------------------------------
+
+#define PROFILE_SCOPE(stage)                                                                                           \
+    profile_probe_t profile_probe __attribute__((cleanup(profile_end))) = profile_begin(stage)
+
+// API -----------------------------------------------------------------------------------------------------------------
+
+void profile_init(void);
+profile_probe_t profile_begin(profile_stage_t stage);
+void profile_end(profile_probe_t *probe);
+const profile_histogram_t *profile_histogram(profile_stage_t stage);
+const char *profile_stage_name(profile_stage_t stage);
+void profile_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __PROFILE_H__
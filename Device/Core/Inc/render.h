@@ -0,0 +1,49 @@
+#ifndef __RENDER_H__
+#define __RENDER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Constants -----------------------------------------------------------------------------------------------------------
+
+#define RENDER_MAX_COMMANDS 128 // Commands in one display list
+#define RENDER_MAX_ARGS 7       // Integer arguments of the longest command
+
+// Types ---------------------------------------------------------------------------------------------------------------
+
+// Display lists: a batch of drawing commands checked as a whole, drawn into the back buffer (mostly by DMA2D) and
+// presented with a single swap, so the screen changes from one complete frame to the next at vertical blanking.
+
+typedef enum {
+    RENDER_FILL_RECT,   // x, y, width, height, color
+    RENDER_DRAW_ASSET,  // id, x, y[, color]
+    RENDER_COPY_REGION, // src_x, src_y, width, height, dest_x, dest_y, copied from the frame on screen
+    RENDER_REGION,      // x, y, width, height and packed RGB565 data
+    RENDER_DRAW_TEXT,   // x, y, font, color and the text
+    RENDER_OP_COUNT,
+} render_op_t;
+
+typedef struct {
+    render_op_t op;
+    uint8_t arg_count;
+    uint32_t args[RENDER_MAX_ARGS];
+    const uint8_t *data; // Byte or text string argument, read in place from the message buffer
+    size_t data_length;
+} render_command_t;
+
+// API -----------------------------------------------------------------------------------------------------------------
+
+bool render_find_op(const char *name, render_op_t *op);
+bool render_check(const render_command_t *command);
+void render_execute(const render_command_t *commands, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __RENDER_H__
@@ -0,0 +1,89 @@
+#ifndef __RPC_PARSER_H__
+#define __RPC_PARSER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Constants -----------------------------------------------------------------------------------------------------------
+
+#define RPC_PARSER_NAME_SIZE 32 // Longest method or parameter name kept, including the terminator
+
+// Types ---------------------------------------------------------------------------------------------------------------
+
+// Resumable push-parser for one length-prefixed RPC frame. It decodes the 4-byte length prefix, the root map, the
+// "method" value and the keys of the "params" map as bytes arrive, and skips everything else. Only definite-length
+// CBOR is understood; anything else sets cbor_error and the parser keeps counting bytes so framing stays intact.
+
+typedef enum {
+    RPC_PARSER_NEED_MORE,   // Byte consumed, nothing new to report
+    RPC_PARSER_LENGTH,      // Length prefix complete, message_length is valid
+    RPC_PARSER_PARAM_BYTES, // Header of a byte string parameter parsed, param_name/param_length/param_*offset valid
+    RPC_PARSER_COMPLETE,    // Last byte of the frame consumed
+} rpc_parser_event_t;
+
+typedef enum {
+    RPC_PARSER_STATE_PREFIX = 0, // Reading the length prefix (zero so a zeroed parser is ready to use)
+    RPC_PARSER_STATE_HEADER,     // Reading the initial byte of a CBOR item
+    RPC_PARSER_STATE_ARGUMENT,   // Reading the length/value bytes that follow the initial byte
+    RPC_PARSER_STATE_STRING,     // Reading the contents of a byte or text string
+    RPC_PARSER_STATE_BODY_ONLY,  // Counting the rest of the frame without parsing it
+    RPC_PARSER_STATE_DONE,       // Frame complete
+} rpc_parser_state_t;
+
+typedef struct {
+    rpc_parser_state_t state;
+
+    // Framing
+    uint32_t message_length; // CBOR body length from the prefix
+    uint32_t offset;         // CBOR body bytes consumed so far
+    uint8_t prefix_bytes;
+
+    // Item being decoded
+    uint8_t major_type;
+    uint8_t role;
+    uint8_t argument_bytes;
+    uint64_t argument;
+    uint32_t item_offset; // Body offset of the item's initial byte
+    uint32_t string_remaining;
+    char text[RPC_PARSER_NAME_SIZE];
+    uint8_t text_length;
+    bool text_truncated;
+
+    // Nesting
+    bool root_started;
+    bool in_params;
+    uint8_t root_key;
+    uint32_t root_items;
+    uint32_t params_items;
+    uint32_t skip_items;
+
+    // Results
+    char method[RPC_PARSER_NAME_SIZE];
+    bool has_method;
+    bool has_params;
+    char param_name[RPC_PARSER_NAME_SIZE];
+    uint32_t param_length;        // Length of the byte string reported by RPC_PARSER_PARAM_BYTES
+    uint32_t param_offset;        // Body offset of its first payload byte
+    uint32_t param_header_offset; // Body offset of its initial byte
+    bool cbor_complete;           // Root map fully decoded
+    bool cbor_error;              // Unsupported or malformed CBOR seen
+} rpc_parser_t;
+
+// API -----------------------------------------------------------------------------------------------------------------
+
+void rpc_parser_reset(rpc_parser_t *parser);
+rpc_parser_event_t rpc_parser_push(rpc_parser_t *parser, uint8_t byte);
+rpc_parser_event_t rpc_parser_skip(rpc_parser_t *parser, uint32_t length);
+void rpc_parser_discard(rpc_parser_t *parser);
+uint32_t rpc_parser_remaining(const rpc_parser_t *parser);
+uint32_t rpc_parser_string_remaining(const rpc_parser_t *parser);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __RPC_PARSER_H__
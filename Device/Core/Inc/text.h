@@ -0,0 +1,49 @@
+#ifndef __TEXT_H__
+#define __TEXT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gfx.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Constants -----------------------------------------------------------------------------------------------------------
+
+#define TEXT_FONT_COUNT 2 // Font IDs are 0 to TEXT_FONT_COUNT - 1
+
+// Types ---------------------------------------------------------------------------------------------------------------
+
+// Text drawn into the back buffer with fonts compiled into flash. Each font is an A8 or A4 atlas with its printable
+// ASCII glyphs side by side, generated by the host's make-font command, and every glyph is one DMA2D blend in the
+// text colour. Characters the font does not have are drawn as '?', and a line stops at the right edge of the screen.
+
+typedef struct {
+    uint16_t x;      // Column of the glyph in the atlas
+    uint8_t width;   // Cell width, even in A4 atlases so every cell starts on a byte
+    int8_t offset;   // Cell start relative to the pen, negative for glyphs that overhang to the left
+    uint8_t advance; // Distance from this glyph's pen position to the next one
+} font_glyph_t;
+
+typedef struct {
+    gfx_format_t format; // GFX_FORMAT_A8 or GFX_FORMAT_A4
+    uint8_t height;      // Line height, the atlas is this many rows
+    uint16_t atlas_width;
+    uint8_t first_char;
+    uint8_t glyph_count;
+    const font_glyph_t *glyphs;
+    const uint8_t *atlas;
+} font_t;
+
+// API -----------------------------------------------------------------------------------------------------------------
+
+const font_t *text_get_font(uint32_t font);
+bool text_draw(uint16_t x, uint16_t y, uint32_t font, uint16_t color, const char *text, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __TEXT_H__
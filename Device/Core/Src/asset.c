@@ -0,0 +1,126 @@
+#include "asset.h"
+#include "image.h"
+#include "log.h"
+
+// Private types -------------------------------------------------------------------------------------------------------
+
+typedef struct {
+    asset_t asset;
+    uint32_t capacity; // Bytes reserved in the pool, 0 for an unused ID
+    bool stored;       // Upload complete
+} asset_entry_t;
+
+// Private variables ---------------------------------------------------------------------------------------------------
+
+static uint8_t asset_pool[ASSET_POOL_SIZE] __attribute__((section(".sdram"), aligned(4)));
+static uint32_t asset_pool_used = 0;
+static asset_entry_t assets[ASSET_MAX_COUNT];
+
+// Upload in progress
+static uint32_t upload_id;
+
+// Public functions ----------------------------------------------------------------------------------------------------
+
+size_t asset_data_size(uint16_t width, uint16_t height, gfx_format_t format)
+{
+    size_t pixels = (size_t) width * height;
+
+    switch (format) {
+    case GFX_FORMAT_ARGB8888:
+        return pixels * 4;
+    case GFX_FORMAT_RGB565:
+    case GFX_FORMAT_ARGB4444:
+        return pixels * 2;
+    case GFX_FORMAT_A8:
+        return pixels;
+    case GFX_FORMAT_A4:
+        return pixels / 2;
+    default:
+        return 0;
+    }
+}
+
+uint8_t *asset_begin_upload(uint32_t id, uint16_t width, uint16_t height, gfx_format_t format)
+{
+    size_t size = asset_data_size(width, height, format);
+
+    // 4-bit lines have to start on a byte
+    if (id >= ASSET_MAX_COUNT || size == 0 || (format == GFX_FORMAT_A4 && width % 2 != 0)) {
+        LOG_ERROR("Error: Invalid asset %lu (%ux%u)\r\n", id, width, height);
+        return NULL;
+    }
+
+    asset_entry_t *entry = &assets[id];
+
+    // Queued draws may still read the old image
+    gfx_wait();
+    entry->stored = false;
+
+    // Keep the space when the new image fits, otherwise take more from the pool (word aligned for ARGB8888)
+    if (size > entry->capacity) {
+        uint32_t capacity = (size + 3) & ~3u;
+        if (capacity > ASSET_POOL_SIZE - asset_pool_used) {
+            LOG_ERROR("Error: Asset pool full, %lu of %u bytes used\r\n", asset_pool_used, ASSET_POOL_SIZE);
+            entry->capacity = 0;
+            return NULL;
+        }
+
+        entry->asset.data = &asset_pool[asset_pool_used];
+        entry->capacity = capacity;
+        asset_pool_used += capacity;
+    }
+
+    entry->asset.width = width;
+    entry->asset.height = height;
+    entry->asset.format = format;
+    upload_id = id;
+
+    return (uint8_t *) entry->asset.data;
+}
+
+void asset_commit_upload(void)
+{
+    assets[upload_id].stored = true;
+    LOG_DEBUG("Asset %lu stored (%ux%u, %lu of %u pool bytes used)\r\n", upload_id, assets[upload_id].asset.width,
+              assets[upload_id].asset.height, asset_pool_used, ASSET_POOL_SIZE);
+}
+
+const asset_t *asset_get(uint32_t id)
+{
+    if (id >= ASSET_MAX_COUNT || !assets[id].stored) {
+        return NULL;
+    }
+
+    return &assets[id].asset;
+}
+
+bool asset_draw(uint32_t id, uint16_t x, uint16_t y, uint32_t color)
+{
+    const asset_t *asset = asset_get(id);
+
+    if (asset == NULL || x + asset->width > IMAGE_WIDTH || y + asset->height > IMAGE_HEIGHT) {
+        return false;
+    }
+
+    uint16_t *dest = &get_draw_buffer()[y * IMAGE_WIDTH + x];
+
+    // Opaque assets need no blending
+    if (asset->format == GFX_FORMAT_RGB565) {
+        return gfx_copy(dest, IMAGE_WIDTH, asset->data, asset->width, asset->width, asset->height,
+                        GFX_FORMAT_RGB565, NULL, NULL);
+    }
+
+    return gfx_blend(dest, IMAGE_WIDTH, GFX_FORMAT_RGB565, asset->data, asset->width, asset->format, asset->width,
+                     asset->height, color, NULL, NULL);
+}
+
+void asset_clear(void)
+{
+    gfx_wait();
+
+    for (uint32_t i = 0; i < ASSET_MAX_COUNT; i++) {
+        assets[i].capacity = 0;
+        assets[i].stored = false;
+    }
+    asset_pool_used = 0;
+}
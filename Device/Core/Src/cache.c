@@ -0,0 +1,129 @@
+#include "cache.h"
+#include "main.h"
+#include <stdbool.h>
+
+// Private macros ------------------------------------------------------------------------------------------------------
+
+#define CACHE_SRAM_BASE SRAM1_BASE               // DTCM below it is never cached
+#define CACHE_SRAM_END (SRAM2_BASE + 16 * 1024) // End of SRAM2
+#define CACHE_SDRAM_END (CACHE_SDRAM_BASE + CACHE_SDRAM_SIZE)
+
+// Private functions ---------------------------------------------------------------------------------------------------
+
+static bool cache_overlaps(uint32_t start, uint32_t end, uint32_t base, uint32_t limit)
+{
+    return start < limit && end > base;
+}
+
+// Only write-back memory can hold lines newer than memory
+static bool cache_is_write_back(uint32_t start, uint32_t end)
+{
+    return cache_overlaps(start, end, CACHE_SRAM_BASE, CACHE_SRAM_END);
+}
+
+static bool cache_is_cached(uint32_t start, uint32_t end)
+{
+    return cache_is_write_back(start, end) || cache_overlaps(start, end, CACHE_SDRAM_BASE, CACHE_SDRAM_END);
+}
+
+// Public functions ----------------------------------------------------------------------------------------------------
+
+void cache_init(void)
+{
+    HAL_MPU_Disable();
+
+    // Background region: no access to the external memory windows in subregions 3, 4 and 6 of 512 MB (FMC banks 1 and
+    // 3, QSPI memory and SDRAM) unless a region below opens them. Code, SRAM, peripherals, the FMC and QSPI control
+    // registers in subregion 5 at 0xA0000000 and the system space keep the default map, registers as device memory.
+    HAL_MPU_ConfigRegion(&(MPU_Region_InitTypeDef) {
+        .Enable = MPU_REGION_ENABLE,
+        .Number = MPU_REGION_NUMBER0,
+        .BaseAddress = 0x00000000,
+        .Size = MPU_REGION_SIZE_4GB,
+        .SubRegionDisable = 0xA7,
+        .TypeExtField = MPU_TEX_LEVEL0,
+        .AccessPermission = MPU_REGION_NO_ACCESS,
+        .DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE,
+        .IsShareable = MPU_ACCESS_SHAREABLE,
+        .IsCacheable = MPU_ACCESS_NOT_CACHEABLE,
+        .IsBufferable = MPU_ACCESS_NOT_BUFFERABLE,
+    });
+
+    // Flash: write-through, it is only ever read
+    HAL_MPU_ConfigRegion(&(MPU_Region_InitTypeDef) {
+        .Enable = MPU_REGION_ENABLE,
+        .Number = MPU_REGION_NUMBER1,
+        .BaseAddress = FLASHAXI_BASE,
+        .Size = MPU_REGION_SIZE_1MB,
+        .SubRegionDisable = 0x00,
+        .TypeExtField = MPU_TEX_LEVEL0,
+        .AccessPermission = MPU_REGION_FULL_ACCESS,
+        .DisableExec = MPU_INSTRUCTION_ACCESS_ENABLE,
+        .IsShareable = MPU_ACCESS_NOT_SHAREABLE,
+        .IsCacheable = MPU_ACCESS_CACHEABLE,
+        .IsBufferable = MPU_ACCESS_NOT_BUFFERABLE,
+    });
+
+    // DTCM, SRAM1 and SRAM2: write-back with write allocate for the stack and variables. Shareable would make the M7
+    // treat it as uncached.
+    HAL_MPU_ConfigRegion(&(MPU_Region_InitTypeDef) {
+        .Enable = MPU_REGION_ENABLE,
+        .Number = MPU_REGION_NUMBER2,
+        .BaseAddress = RAMDTCM_BASE,
+        .Size = MPU_REGION_SIZE_512KB,
+        .SubRegionDisable = 0x00,
+        .TypeExtField = MPU_TEX_LEVEL1,
+        .AccessPermission = MPU_REGION_FULL_ACCESS,
+        .DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE,
+        .IsShareable = MPU_ACCESS_NOT_SHAREABLE,
+        .IsCacheable = MPU_ACCESS_CACHEABLE,
+        .IsBufferable = MPU_ACCESS_BUFFERABLE,
+    });
+
+    // SDRAM: write-through without write allocate. Pixel data streams through without evicting the parser's working
+    // set, and LTDC and DMA2D never find a frame waiting in the cache.
+    HAL_MPU_ConfigRegion(&(MPU_Region_InitTypeDef) {
+        .Enable = MPU_REGION_ENABLE,
+        .Number = MPU_REGION_NUMBER3,
+        .BaseAddress = CACHE_SDRAM_BASE,
+        .Size = MPU_REGION_SIZE_8MB,
+        .SubRegionDisable = 0x00,
+        .TypeExtField = MPU_TEX_LEVEL0,
+        .AccessPermission = MPU_REGION_FULL_ACCESS,
+        .DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE,
+        .IsShareable = MPU_ACCESS_NOT_SHAREABLE,
+        .IsCacheable = MPU_ACCESS_CACHEABLE,
+        .IsBufferable = MPU_ACCESS_NOT_BUFFERABLE,
+    });
+
+    HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+
+    SCB_EnableICache();
+    SCB_EnableDCache();
+}
+
+void cache_clean(const void *address, size_t size)
+{
+    uint32_t start = (uint32_t) address & ~(CACHE_LINE_SIZE - 1);
+    uint32_t end = (uint32_t) address + size;
+
+    if (size == 0 || !cache_is_write_back(start, end)) {
+        return;
+    }
+
+    SCB_CleanDCache_by_Addr((uint32_t *) start, (int32_t) (end - start));
+}
+
+// A partial line at either end is dropped whole, so in write-back memory a buffer that DMA writes has its lines to
+// itself. SDRAM never holds dirty lines, so there any range is safe.
+void cache_invalidate(const void *address, size_t size)
+{
+    uint32_t start = (uint32_t) address & ~(CACHE_LINE_SIZE - 1);
+    uint32_t end = (uint32_t) address + size;
+
+    if (size == 0 || !cache_is_cached(start, end)) {
+        return;
+    }
+
+    SCB_InvalidateDCache_by_Addr((uint32_t *) start, (int32_t) (end - start));
+}
@@ -1,16 +1,26 @@
 #include "comm.h"
+#include "asset.h"
 #include "cbor.h"
+#include "gfx.h"
 #include "image.h"
-#include <stdio.h>
+#include "log.h"
+#include "overlay.h"
+#include "playback.h"
+#include "plot.h"
+#include "profile.h"
+#include "render.h"
+#include "rpc_parser.h"
+#include "text.h"
 #include <string.h>
 
 // Private macros ------------------------------------------------------------------------------------------------------
 
 #define RESET_MESSAGE_STATE()                                                                                          \
     do {                                                                                                               \
-        bytes_received = 0;                                                                                            \
-        expected_length = 0;                                                                                           \
-        state = 0;                                                                                                     \
+        rpc_parser_reset(&parser);                                                                                     \
+        state = MESSAGE_STATE_RECEIVE;                                                                                 \
+        stream = NULL;                                                                                                 \
+        stream_offset = 0;                                                                                             \
     } while (0)
 
 #define SKIP_KEY_VALUE_PAIR(cbor_value_ptr)                                                                            \
@@ -26,110 +36,506 @@
         continue;                                                                                                      \
     } while (0)
 
+#define IMAGE_CHUNK_BLOCK_COUNT ((IMAGE_DATA_SIZE + IMAGE_CHUNK_BLOCK_SIZE - 1) / IMAGE_CHUNK_BLOCK_SIZE)
+
+#define STATS_METHODS_PER_PAGE 12 // Method call counts per get_stats response, enough to fill a slot with long names
+
+// Private types -------------------------------------------------------------------------------------------------------
+
+typedef enum {
+    MESSAGE_STATE_RECEIVE,      // Feeding bytes to the push-parser and buffering the CBOR body in cbor_buffer
+    MESSAGE_STATE_STREAM,       // Writing a byte string payload straight to its destination
+    MESSAGE_STATE_DISCARD,      // Dropping the rest of a rejected message
+} message_state_t;
+
+// A method whose large byte string parameter ends the message and is written to its destination as it arrives,
+// instead of going through cbor_buffer
+typedef struct {
+    const char *method;
+    const char *param;
+    // Checks the params that precede the payload and returns where to write it, or NULL after sending an error
+    uint8_t *(*begin)(CborValue *map_value, uint32_t length);
+    // Finishes the method once the whole payload has been written and sends the response
+    void (*complete)(uint32_t length);
+    bool draws; // Draws into or shows a frame buffer, which ends a chunked image upload in progress
+} stream_handler_t;
+
+// A method handled once its whole message is in cbor_buffer
+typedef struct {
+    const char *method;
+    CborError (*handle)(CborValue *map_value);
+    bool draws; // As for stream_handler_t
+} rpc_method_t;
+
+// Transport and pipeline counters since boot, reported by get_stats. The receive side is counted by the main loop and
+// the transmit side, UART errors and ring overflows by interrupts, each counter by only one of them.
+typedef struct {
+    uint32_t rx_bytes;
+    uint32_t rx_frames; // Length prefixes received, whatever became of the message
+    uint32_t tx_bytes;
+    uint32_t tx_frames; // Responses and raw strings whose transfer completed
+    uint32_t overrun_errors;
+    uint32_t framing_errors;
+    uint32_t noise_errors;
+    uint32_t resyncs;           // Times received data was thrown away to get back in step with the host
+    uint32_t parse_errors;      // Messages whose CBOR could not be parsed
+    uint32_t oversize_messages; // Messages rejected as too large to receive
+    uint32_t ring_overflows;    // Times the DMA wrote over bytes still waiting in the receive ring
+    uint32_t ring_peak;         // Most bytes seen waiting in the receive ring
+} comm_stats_t;
+
+// Video streaming session: frames (whole or as changed regions) arrive back-to-back and each one is acknowledged with
+// the one credit it used. The window is fixed at stream_begin. Frames come in order over the UART, so every frame
+// received is shown; skipping the frames that came due while the window was full is up to the host.
+typedef struct {
+    bool active;
+    uint32_t credits;     // Frames the host may have in flight
+    uint32_t frames;      // Frames shown since stream_begin
+    uint32_t start_tick;  // stream_begin time, for the session average
+    uint32_t window_tick; // Start of the current frame rate window
+    uint32_t window_frames;
+    float fps; // Frames shown per second over the last complete window
+} stream_session_t;
+
 // Private variables ---------------------------------------------------------------------------------------------------
 
 // Place large buffers in SDRAM
 static uint8_t cbor_buffer[CBOR_BUFFER_SIZE] __attribute__((section(".sdram")));
-static uint8_t usart6_rx_buffer[USART6_RX_BUFFER_SIZE] __attribute__((section(".sdram")));
-static volatile uint32_t usart6_rx_head = 0;
-static volatile uint32_t usart6_rx_tail = 0;
+
+// The receive path lives in DTCM: zero wait states for the CPU, and never cached, so DMA needs no cache maintenance.
+// The startup code zeroes the section.
+static uint8_t usart6_rx_buffer[USART6_RX_BUFFER_SIZE] __attribute__((section(".dtcm")));
+static volatile uint32_t usart6_rx_head __attribute__((section(".dtcm")));
+static volatile uint32_t usart6_rx_tail __attribute__((section(".dtcm")));
+static volatile bool usart6_rx_error __attribute__((section(".dtcm")));
+static volatile bool usart6_rx_overflow __attribute__((section(".dtcm")));
+static volatile uint32_t usart6_rx_tick __attribute__((section(".dtcm"))); // Last reception event, for the idle resync
+
+// Response queue - each slot holds the length prefix and CBOR body so they go out as one DMA transfer
+static uint8_t usart6_tx_queue[USART6_TX_QUEUE_LENGTH][USART6_TX_BUFFER_SIZE] __attribute__((section(".dtcm")));
+static uint16_t usart6_tx_length[USART6_TX_QUEUE_LENGTH] __attribute__((section(".dtcm")));
+static volatile uint32_t usart6_tx_head __attribute__((section(".dtcm"))); // Next slot to fill (main loop)
+static volatile uint32_t usart6_tx_tail __attribute__((section(".dtcm"))); // Slot being transmitted (DMA)
+static volatile bool usart6_tx_busy __attribute__((section(".dtcm")));
+
+static volatile comm_stats_t comm_stats __attribute__((section(".dtcm")));
+
+// Chunked image upload - one bit per IMAGE_CHUNK_BLOCK_SIZE block of the framebuffer that has been received
+static bool image_upload_active = false;
+static uint32_t image_upload_size = 0;
+static uint32_t image_upload_blocks[(IMAGE_CHUNK_BLOCK_COUNT + 31) / 32];
+
+static stream_session_t stream_session;
 
 // External variables --------------------------------------------------------------------------------------------------
 
-extern UART_HandleTypeDef huart1;
 extern UART_HandleTypeDef huart6;
 
 // Private functions ---------------------------------------------------------------------------------------------------
 
-static void send_cbor_response(const char *status, const char *message)
+// Where the DMA will write the next received byte, which runs ahead of usart6_rx_head between reception events
+static uint32_t usart6_rx_dma_head(void)
+{
+    return (USART6_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(huart6.hdmarx)) % USART6_RX_BUFFER_SIZE;
+}
+
+// Drop everything waiting in the receive ring
+static void usart6_rx_flush(void)
 {
-    printf("USART6 DEBUG: Preparing response - status: %s, message: %s\r\n", status, message);
+    uint32_t head = usart6_rx_head;
+    comm_stats.rx_bytes += (USART6_RX_BUFFER_SIZE + head - usart6_rx_tail) % USART6_RX_BUFFER_SIZE;
+    usart6_rx_tail = head;
+}
 
-    // Create response object
-    CborEncoder encoder;
-    uint8_t response_buffer[256];
+static void usart6_tx_kick(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
 
-    cbor_encoder_init(&encoder, response_buffer, sizeof(response_buffer), 0);
+    // Start the next queued slot unless a transfer is already in flight
+    if (!usart6_tx_busy && usart6_tx_tail != usart6_tx_head) {
+        usart6_tx_busy = true;
+        HAL_UART_Transmit_DMA(&huart6, usart6_tx_queue[usart6_tx_tail], usart6_tx_length[usart6_tx_tail]);
+    }
 
-    CborEncoder map_encoder;
-    cbor_encoder_create_map(&encoder, &map_encoder, 2);
+    __set_PRIMASK(primask);
+}
+
+static uint8_t *usart6_tx_acquire(void)
+{
+    // Wait for a free slot - only happens when responses are produced faster than the link drains them
+    while ((usart6_tx_head + 1) % USART6_TX_QUEUE_LENGTH == usart6_tx_tail) {
+    }
+
+    return usart6_tx_queue[usart6_tx_head];
+}
+
+static void usart6_tx_commit(size_t encoded_size)
+{
+    uint8_t *slot = usart6_tx_queue[usart6_tx_head];
+
+    // Length prefix (4 bytes, big-endian) in front of the CBOR body
+    slot[0] = (uint8_t) (encoded_size >> 24);
+    slot[1] = (uint8_t) (encoded_size >> 16);
+    slot[2] = (uint8_t) (encoded_size >> 8);
+    slot[3] = (uint8_t) (encoded_size & 0xFF);
+
+    LOG_DEBUG("USART6 Queueing length prefix: %02X %02X %02X %02X\r\n", slot[0], slot[1], slot[2], slot[3]);
+
+    usart6_tx_length[usart6_tx_head] = (uint16_t) (encoded_size + 4);
+    usart6_tx_head = (usart6_tx_head + 1) % USART6_TX_QUEUE_LENGTH;
+
+    usart6_tx_kick();
+}
+
+// Encodes a response map straight into a queue slot, after the length prefix. The map holds status and message plus
+// extra_fields more key/value pairs that the caller adds before end_response()
+static uint8_t *begin_response(CborEncoder *encoder, CborEncoder *map_encoder, const char *status, const char *message,
+                               size_t extra_fields)
+{
+    uint8_t *response_buffer = usart6_tx_acquire() + 4;
+
+    cbor_encoder_init(encoder, response_buffer, USART6_TX_BUFFER_SIZE - 4, 0);
+    cbor_encoder_create_map(encoder, map_encoder, 2 + extra_fields);
 
     // Add status
-    cbor_encode_text_string(&map_encoder, "status", 6);
-    cbor_encode_text_string(&map_encoder, status, strlen(status));
+    cbor_encode_text_string(map_encoder, "status", 6);
+    cbor_encode_text_string(map_encoder, status, strlen(status));
 
     // Add message
-    cbor_encode_text_string(&map_encoder, "message", 7);
-    cbor_encode_text_string(&map_encoder, message, strlen(message));
+    cbor_encode_text_string(map_encoder, "message", 7);
+    cbor_encode_text_string(map_encoder, message, strlen(message));
+
+    return response_buffer;
+}
+
+static void end_response(CborEncoder *encoder, CborEncoder *map_encoder, const uint8_t *response_buffer)
+{
+    cbor_encoder_close_container(encoder, map_encoder);
+
+    size_t encoded_size = cbor_encoder_get_buffer_size(encoder, response_buffer);
 
-    cbor_encoder_close_container(&encoder, &map_encoder);
+    LOG_DEBUG("USART6 Response encoded, size: %lu bytes\r\n", (unsigned long) encoded_size);
 
-    size_t encoded_size = cbor_encoder_get_buffer_size(&encoder, response_buffer);
+    usart6_tx_commit(encoded_size);
+}
 
-    printf("USART6 DEBUG: Response encoded, size: %lu bytes\r\n", (unsigned long) encoded_size);
+static void send_cbor_response(const char *status, const char *message)
+{
+    PROFILE_SCOPE(PROFILE_STAGE_RESPONSE);
 
-    // Send length prefix (4 bytes, big-endian)
-    uint8_t length_prefix[4];
-    length_prefix[0] = (uint8_t) (encoded_size >> 24);
-    length_prefix[1] = (uint8_t) (encoded_size >> 16);
-    length_prefix[2] = (uint8_t) (encoded_size >> 8);
-    length_prefix[3] = (uint8_t) (encoded_size & 0xFF);
+    LOG_DEBUG("USART6 Preparing response - status: %s, message: %s\r\n", status, message);
 
-    printf("USART6 DEBUG: Sending length prefix: %02X %02X %02X %02X\r\n", length_prefix[0], length_prefix[1],
-           length_prefix[2], length_prefix[3]);
+    CborEncoder encoder;
+    CborEncoder map_encoder;
+    uint8_t *response_buffer = begin_response(&encoder, &map_encoder, status, message, 0);
 
-    HAL_UART_Transmit(&huart6, length_prefix, 4, HAL_MAX_DELAY);
-    HAL_UART_Transmit(&huart6, response_buffer, encoded_size, HAL_MAX_DELAY);
+    end_response(&encoder, &map_encoder, response_buffer);
 
-    printf("USART6 DEBUG: Response sent successfully\r\n");
+    LOG_DEBUG("USART6 Response queued successfully\r\n");
 }
 
 static void send_test_response(const char *status, const char *message, const char *received_message)
 {
-    printf("USART6 DEBUG: Preparing test response - status: %s, message: %s, received_message: %s\r\n", status, message,
-           received_message);
+    PROFILE_SCOPE(PROFILE_STAGE_RESPONSE);
+
+    LOG_DEBUG("USART6 Preparing test response - status: %s, message: %s, received_message: %s\r\n", status, message,
+              received_message);
 
-    // Create response object
     CborEncoder encoder;
-    uint8_t response_buffer[512];
+    CborEncoder map_encoder;
+    uint8_t *response_buffer = begin_response(&encoder, &map_encoder, status, message, 1);
+
+    // Add received_message
+    cbor_encode_text_string(&map_encoder, "received_message", 16);
+    cbor_encode_text_string(&map_encoder, received_message, strlen(received_message));
+
+    end_response(&encoder, &map_encoder, response_buffer);
 
-    cbor_encoder_init(&encoder, response_buffer, sizeof(response_buffer), 0);
+    LOG_DEBUG("USART6 Test response queued successfully\r\n");
+}
+
+static void send_offset_response(const char *status, const char *message, uint32_t offset)
+{
+    PROFILE_SCOPE(PROFILE_STAGE_RESPONSE);
+
+    LOG_DEBUG("USART6 Preparing offset response - status: %s, message: %s, offset: %lu\r\n", status, message,
+              offset);
 
+    CborEncoder encoder;
     CborEncoder map_encoder;
-    cbor_encoder_create_map(&encoder, &map_encoder, 3);
+    uint8_t *response_buffer = begin_response(&encoder, &map_encoder, status, message, 1);
 
-    // Add status
-    cbor_encode_text_string(&map_encoder, "status", 6);
-    cbor_encode_text_string(&map_encoder, status, strlen(status));
+    // Add offset so the host can match the acknowledgement to its chunk
+    cbor_encode_text_string(&map_encoder, "offset", 6);
+    cbor_encode_uint(&map_encoder, offset);
 
-    // Add message
-    cbor_encode_text_string(&map_encoder, "message", 7);
-    cbor_encode_text_string(&map_encoder, message, strlen(message));
+    end_response(&encoder, &map_encoder, response_buffer);
+}
 
-    // Add received_message
-    cbor_encode_text_string(&map_encoder, "received_message", 16);
-    cbor_encode_text_string(&map_encoder, received_message, strlen(received_message));
+// Acknowledges a stream frame, handing back the one credit it used along with the frame rate achieved so far
+static void send_stream_ack(const char *status, const char *message, uint32_t seq)
+{
+    PROFILE_SCOPE(PROFILE_STAGE_RESPONSE);
+
+    CborEncoder encoder;
+    CborEncoder map_encoder;
+    uint8_t *response_buffer = begin_response(&encoder, &map_encoder, status, message, 3);
+
+    cbor_encode_text_string(&map_encoder, "seq", 3);
+    cbor_encode_uint(&map_encoder, seq);
+    cbor_encode_text_string(&map_encoder, "credits", 7);
+    cbor_encode_uint(&map_encoder, 1);
+    cbor_encode_text_string(&map_encoder, "fps", 3);
+    cbor_encode_float(&map_encoder, stream_session.fps);
+
+    end_response(&encoder, &map_encoder, response_buffer);
+}
+
+// Reports a session's credits when it starts and its totals when it ends
+static void send_stream_summary(const char *message)
+{
+    PROFILE_SCOPE(PROFILE_STAGE_RESPONSE);
+
+    uint32_t elapsed = HAL_GetTick() - stream_session.start_tick;
+    float average = elapsed > 0 ? stream_session.frames * 1000.0f / elapsed : 0.0f;
+
+    CborEncoder encoder;
+    CborEncoder map_encoder;
+    uint8_t *response_buffer = begin_response(&encoder, &map_encoder, "success", message, 3);
+
+    cbor_encode_text_string(&map_encoder, "credits", 7);
+    cbor_encode_uint(&map_encoder, stream_session.credits);
+    cbor_encode_text_string(&map_encoder, "frames", 6);
+    cbor_encode_uint(&map_encoder, stream_session.frames);
+    cbor_encode_text_string(&map_encoder, "fps", 3);
+    cbor_encode_float(&map_encoder, average);
+
+    end_response(&encoder, &map_encoder, response_buffer);
+}
+
+// Reports one stage's histogram in cycles, with the clock that converts them to time. All the stages together would
+// not fit a response slot, so the host asks for them in turn until stage reaches stages.
+static void send_profile_response(profile_stage_t stage)
+{
+    PROFILE_SCOPE(PROFILE_STAGE_RESPONSE);
+
+    const profile_histogram_t *histogram = profile_histogram(stage);
+    const char *name = profile_stage_name(stage);
+
+    CborEncoder encoder;
+    CborEncoder map_encoder;
+    CborEncoder bucket_encoder;
+    uint8_t *response_buffer = begin_response(&encoder, &map_encoder, "success", "Profile read", 9);
+
+    cbor_encode_text_string(&map_encoder, "stage", 5);
+    cbor_encode_text_string(&map_encoder, name, strlen(name));
+    cbor_encode_text_string(&map_encoder, "index", 5);
+    cbor_encode_uint(&map_encoder, stage);
+    cbor_encode_text_string(&map_encoder, "stages", 6);
+    cbor_encode_uint(&map_encoder, PROFILE_STAGE_COUNT);
+    cbor_encode_text_string(&map_encoder, "clock", 5);
+    cbor_encode_uint(&map_encoder, HAL_RCC_GetHCLKFreq());
+    cbor_encode_text_string(&map_encoder, "count", 5);
+    cbor_encode_uint(&map_encoder, histogram->count);
+    cbor_encode_text_string(&map_encoder, "total", 5);
+    cbor_encode_uint(&map_encoder, histogram->total);
+    cbor_encode_text_string(&map_encoder, "min", 3);
+    cbor_encode_uint(&map_encoder, histogram->count > 0 ? histogram->min : 0);
+    cbor_encode_text_string(&map_encoder, "max", 3);
+    cbor_encode_uint(&map_encoder, histogram->max);
+
+    // Bucket n counts durations of 2^n cycles and up
+    cbor_encode_text_string(&map_encoder, "buckets", 7);
+    cbor_encoder_create_array(&map_encoder, &bucket_encoder, PROFILE_BUCKET_COUNT);
+    for (size_t i = 0; i < PROFILE_BUCKET_COUNT; i++) {
+        cbor_encode_uint(&bucket_encoder, histogram->buckets[i]);
+    }
+    cbor_encoder_close_container(&map_encoder, &bucket_encoder);
+
+    end_response(&encoder, &map_encoder, response_buffer);
+}
+
+// Looks up a key in a map without consuming the map iterator
+static CborError find_param(const CborValue *map, const char *name, CborValue *result)
+{
+    CborValue it = *map;
+    CborError err;
+
+    while (!cbor_value_at_end(&it)) {
+        bool matches = false;
+
+        if (cbor_value_is_text_string(&it)) {
+            err = cbor_value_text_string_equals(&it, name, &matches);
+            if (err != CborNoError) {
+                return err;
+            }
+        }
+
+        err = cbor_value_advance(&it);
+        if (err != CborNoError) {
+            return err;
+        }
+
+        if (matches) {
+            *result = it;
+            return CborNoError;
+        }
+
+        err = cbor_value_advance(&it);
+        if (err != CborNoError) {
+            return err;
+        }
+    }
+
+    return CborErrorUnknownType;
+}
+
+// Finds the "params" value in the root map and enters it
+static CborError enter_params_map(const CborValue *map_value, CborValue *params_map)
+{
+    CborValue params;
+
+    CborError err = find_param(map_value, "params", &params);
+    if (err != CborNoError) {
+        return err;
+    }
+
+    if (!cbor_value_is_map(&params)) {
+        return CborErrorIllegalType;
+    }
+
+    return cbor_value_enter_container(&params, params_map);
+}
+
+// Reads an unsigned integer value that must fit in 32 bits
+static CborError read_uint32(const CborValue *value, uint32_t *result)
+{
+    uint64_t raw;
+
+    if (!cbor_value_is_unsigned_integer(value)) {
+        return CborErrorIllegalType;
+    }
+
+    CborError err = cbor_value_get_uint64(value, &raw);
+    if (err != CborNoError) {
+        return err;
+    }
 
-    cbor_encoder_close_container(&encoder, &map_encoder);
+    if (raw > UINT32_MAX) {
+        return CborErrorDataTooLarge;
+    }
+
+    *result = (uint32_t) raw;
+    return CborNoError;
+}
+
+// Reads a signed or unsigned integer value that must fit in 32 bits
+static CborError read_int32(const CborValue *value, int32_t *result)
+{
+    int raw;
+
+    if (!cbor_value_is_integer(value)) {
+        return CborErrorIllegalType;
+    }
+
+    CborError err = cbor_value_get_int_checked(value, &raw);
+    if (err == CborNoError) {
+        *result = raw;
+    }
+    return err;
+}
+
+// Reads the named unsigned integer params, all of which are required
+static CborError read_uint32_params(const CborValue *map_value, const char *const names[], uint32_t values[],
+                                    size_t count)
+{
+    CborValue params_map;
+    CborValue value;
+
+    CborError err = enter_params_map(map_value, &params_map);
+    for (size_t i = 0; i < count && err == CborNoError; i++) {
+        err = find_param(&params_map, names[i], &value);
+        if (err == CborNoError) {
+            err = read_uint32(&value, &values[i]);
+        }
+    }
+
+    return err;
+}
+
+// Reads an optional unsigned integer param, leaving *result alone when the param is missing
+static CborError read_optional_uint32(const CborValue *map_value, const char *name, uint32_t *result)
+{
+    CborValue params_map;
+    CborValue value;
+
+    CborError err = enter_params_map(map_value, &params_map);
+    if (err != CborNoError || find_param(&params_map, name, &value) != CborNoError) {
+        return err;
+    }
+
+    return read_uint32(&value, result);
+}
+
+// Reads an optional text param that must be one of choices, leaving *index alone when the param is missing
+static CborError read_choice_param(const CborValue *map_value, const char *name, const char *const choices[],
+                                   size_t count, uint32_t *index)
+{
+    CborValue params_map;
+    CborValue value;
+
+    CborError err = enter_params_map(map_value, &params_map);
+    if (err != CborNoError) {
+        return err;
+    }
+    if (find_param(&params_map, name, &value) != CborNoError) {
+        return CborNoError;
+    }
+    if (!cbor_value_is_text_string(&value)) {
+        return CborErrorIllegalType;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        bool matches = false;
+        err = cbor_value_text_string_equals(&value, choices[i], &matches);
+        if (err != CborNoError) {
+            return err;
+        }
+        if (matches) {
+            *index = i;
+            return CborNoError;
+        }
+    }
 
-    size_t encoded_size = cbor_encoder_get_buffer_size(&encoder, response_buffer);
+    return CborErrorIllegalSimpleType;
+}
 
-    printf("USART6 DEBUG: Test response encoded, size: %lu bytes\r\n", (unsigned long) encoded_size);
+// Points at the contents of a definite-length byte or text string inside the message buffer instead of copying it
+static CborError get_string_data(const CborValue *value, const uint8_t **data, size_t *length)
+{
+    CborValue next = *value;
 
-    // Send length prefix (4 bytes, big-endian)
-    uint8_t length_prefix[4];
-    length_prefix[0] = (uint8_t) (encoded_size >> 24);
-    length_prefix[1] = (uint8_t) (encoded_size >> 16);
-    length_prefix[2] = (uint8_t) (encoded_size >> 8);
-    length_prefix[3] = (uint8_t) (encoded_size & 0xFF);
+    if (!cbor_value_is_byte_string(value) && !cbor_value_is_text_string(value)) {
+        return CborErrorIllegalType;
+    }
 
-    printf("USART6 DEBUG: Sending test response length prefix: %02X %02X %02X %02X\r\n", length_prefix[0],
-           length_prefix[1], length_prefix[2], length_prefix[3]);
+    // The push-parser rejects indefinite lengths, so the contents end right where the next item starts
+    CborError err = cbor_value_get_string_length(value, length);
+    if (err == CborNoError) {
+        err = cbor_value_advance(&next);
+    }
+    if (err != CborNoError) {
+        return err;
+    }
 
-    HAL_UART_Transmit(&huart6, length_prefix, 4, HAL_MAX_DELAY);
-    HAL_UART_Transmit(&huart6, response_buffer, encoded_size, HAL_MAX_DELAY);
+    *data = cbor_value_get_next_byte(&next) - *length;
+    return CborNoError;
+}
 
-    printf("USART6 DEBUG: Test response sent successfully\r\n");
+static CborError get_byte_string(const CborValue *value, const uint8_t **data, size_t *length)
+{
+    return cbor_value_is_byte_string(value) ? get_string_data(value, data, length) : CborErrorIllegalType;
 }
 
 static CborError process_display_params(CborValue *params_map)
@@ -137,11 +543,11 @@ static CborError process_display_params(CborValue *params_map)
     CborError err;
     bool found_image_data = false;
 
-    printf("USART6 DEBUG: Starting parameter processing\r\n");
+    LOG_DEBUG("USART6 Starting parameter processing\r\n");
 
     while (!cbor_value_at_end(params_map)) {
         if (!cbor_value_is_text_string(params_map)) {
-            printf("USART6 DEBUG: Skipping non-text key\r\n");
+            LOG_DEBUG("USART6 Skipping non-text key\r\n");
             SKIP_KEY_VALUE_PAIR(params_map);
         }
 
@@ -149,24 +555,24 @@ static CborError process_display_params(CborValue *params_map)
         size_t param_length = sizeof(param_name);
         err = cbor_value_copy_text_string(params_map, param_name, &param_length, NULL);
         if (err != CborNoError) {
-            printf("USART6 DEBUG: Error reading parameter name: %d\r\n", err);
+            LOG_DEBUG("USART6 Error reading parameter name: %d\r\n", err);
             return err;
         }
 
-        printf("USART6 DEBUG: Found parameter: %s\r\n", param_name);
+        LOG_DEBUG("USART6 Found parameter: %s\r\n", param_name);
 
         if (strcmp(param_name, "image_data") == 0) {
-            printf("USART6 DEBUG: Processing image_data parameter\r\n");
+            LOG_DEBUG("USART6 Processing image_data parameter\r\n");
             // Move to image data value
             err = cbor_value_advance(params_map);
             if (err != CborNoError) {
-                printf("USART6 DEBUG: Error advancing to image data value: %d\r\n", err);
+                LOG_DEBUG("USART6 Error advancing to image data value: %d\r\n", err);
                 return err;
             }
 
             // Process image data
             if (!cbor_value_is_byte_string(params_map)) {
-                printf("USART6 DEBUG: Image data is not a byte string\r\n");
+                LOG_DEBUG("USART6 Image data is not a byte string\r\n");
                 send_cbor_response("error", "Image data must be byte string");
                 return CborErrorIllegalType;
             }
@@ -174,53 +580,53 @@ static CborError process_display_params(CborValue *params_map)
             size_t image_data_length;
             err = cbor_value_get_string_length(params_map, &image_data_length);
             if (err != CborNoError) {
-                printf("USART6 DEBUG: Error getting image data length: %d\r\n", err);
+                LOG_DEBUG("USART6 Error getting image data length: %d\r\n", err);
                 send_cbor_response("error", "Invalid image data format");
                 return err;
             }
 
-            printf("USART6 DEBUG: Image data length: %lu bytes\r\n", (unsigned long) image_data_length);
+            LOG_DEBUG("USART6 Image data length: %lu bytes\r\n", (unsigned long) image_data_length);
 
             if (image_data_length > IMAGE_DATA_SIZE) {
-                printf("USART6 DEBUG: Image data too large: %zu > %d\r\n", image_data_length, IMAGE_DATA_SIZE);
+                LOG_DEBUG("USART6 Image data too large: %zu > %d\r\n", image_data_length, IMAGE_DATA_SIZE);
                 send_cbor_response("error", "Image data too large");
                 return CborErrorDataTooLarge;
             }
 
             // Copy image data directly to framebuffer
-            uint8_t *image_buffer = get_image_buffer();
+            uint8_t *image_buffer = get_image_buffer(image_data_length);
             err = cbor_value_copy_byte_string(params_map, image_buffer, &image_data_length, NULL);
             if (err != CborNoError) {
-                printf("USART6 DEBUG: Error copying image data: %d\r\n", err);
+                LOG_DEBUG("USART6 Error copying image data: %d\r\n", err);
                 send_cbor_response("error", "Failed to read image data");
                 return err;
             }
 
-            printf("USART6 DEBUG: Image data copied successfully, updating display\r\n");
+            LOG_DEBUG("USART6 Image data copied successfully, updating display\r\n");
             update_display();
             found_image_data = true;
 
             // Continue parsing to look for additional parameters
             err = cbor_value_advance(params_map);
             if (err != CborNoError) {
-                printf("USART6 DEBUG: Error advancing after image data: %d\r\n", err);
+                LOG_DEBUG("USART6 Error advancing after image data: %d\r\n", err);
                 return err;
             }
         }
         else {
-            printf("USART6 DEBUG: Skipping unknown parameter: %s\r\n", param_name);
+            LOG_DEBUG("USART6 Skipping unknown parameter: %s\r\n", param_name);
             SKIP_KEY_VALUE_PAIR(params_map);
         }
     }
 
-    printf("USART6 DEBUG: Parameter processing complete - image_data: %s\r\n", found_image_data ? "YES" : "NO");
+    LOG_DEBUG("USART6 Parameter processing complete - image_data: %s\r\n", found_image_data ? "YES" : "NO");
 
     // Send appropriate response based on what we found
     if (found_image_data) {
         send_cbor_response("success", "Image displayed successfully");
     }
     else {
-        printf("USART6 DEBUG: No valid parameters found\r\n");
+        LOG_DEBUG("USART6 No valid parameters found\r\n");
         send_cbor_response("error", "No valid parameters found (expected image_data)");
         return CborErrorUnknownType;
     }
@@ -234,11 +640,11 @@ static CborError handle_test_method(CborValue *map_value)
     char test_message[128];
     bool found_test_message = false;
 
-    printf("USART6 DEBUG: Handling test method\r\n");
+    LOG_DEBUG("USART6 Handling test method\r\n");
 
     while (!cbor_value_at_end(map_value)) {
         if (!cbor_value_is_text_string(map_value)) {
-            printf("USART6 DEBUG: Skipping non-text key in test method handler\r\n");
+            LOG_DEBUG("USART6 Skipping non-text key in test method handler\r\n");
             SKIP_KEY_VALUE_PAIR(map_value);
         }
 
@@ -246,44 +652,44 @@ static CborError handle_test_method(CborValue *map_value)
         size_t key_length = sizeof(key_name);
         err = cbor_value_copy_text_string(map_value, key_name, &key_length, NULL);
         if (err != CborNoError) {
-            printf("USART6 DEBUG: Error reading test method handler key: %d\r\n", err);
+            LOG_DEBUG("USART6 Error reading test method handler key: %d\r\n", err);
             return err;
         }
 
-        printf("USART6 DEBUG: Found test method handler key: %s\r\n", key_name);
+        LOG_DEBUG("USART6 Found test method handler key: %s\r\n", key_name);
 
         if (strcmp(key_name, "params") == 0) {
-            printf("USART6 DEBUG: Found params field in test method\r\n");
+            LOG_DEBUG("USART6 Found params field in test method\r\n");
             // Move to params value
             err = cbor_value_advance(map_value);
             if (err != CborNoError) {
-                printf("USART6 DEBUG: Error advancing to test params value: %d\r\n", err);
+                LOG_DEBUG("USART6 Error advancing to test params value: %d\r\n", err);
                 return err;
             }
 
             // Enter params map
             if (!cbor_value_is_map(map_value)) {
-                printf("USART6 DEBUG: Test params is not a map\r\n");
+                LOG_DEBUG("USART6 Test params is not a map\r\n");
                 send_cbor_response("error", "Test params must be a map");
                 return CborErrorIllegalType;
             }
 
-            printf("USART6 DEBUG: Test params is a map - good\r\n");
+            LOG_DEBUG("USART6 Test params is a map - good\r\n");
 
             CborValue params_map;
             err = cbor_value_enter_container(map_value, &params_map);
             if (err != CborNoError) {
-                printf("USART6 DEBUG: Error entering test params container: %d\r\n", err);
+                LOG_DEBUG("USART6 Error entering test params container: %d\r\n", err);
                 send_cbor_response("error", "Failed to parse test params");
                 return err;
             }
 
-            printf("USART6 DEBUG: Entered test params container\r\n");
+            LOG_DEBUG("USART6 Entered test params container\r\n");
 
             // Look for test_message parameter
             while (!cbor_value_at_end(&params_map)) {
                 if (!cbor_value_is_text_string(&params_map)) {
-                    printf("USART6 DEBUG: Skipping non-text key in test params\r\n");
+                    LOG_DEBUG("USART6 Skipping non-text key in test params\r\n");
                     SKIP_KEY_VALUE_PAIR(&params_map);
                 }
 
@@ -291,24 +697,24 @@ static CborError handle_test_method(CborValue *map_value)
                 size_t param_length = sizeof(param_name);
                 err = cbor_value_copy_text_string(&params_map, param_name, &param_length, NULL);
                 if (err != CborNoError) {
-                    printf("USART6 DEBUG: Error reading test parameter name: %d\r\n", err);
+                    LOG_DEBUG("USART6 Error reading test parameter name: %d\r\n", err);
                     return err;
                 }
 
-                printf("USART6 DEBUG: Found test parameter: %s\r\n", param_name);
+                LOG_DEBUG("USART6 Found test parameter: %s\r\n", param_name);
 
                 if (strcmp(param_name, "test_message") == 0) {
-                    printf("USART6 DEBUG: Processing test_message parameter\r\n");
+                    LOG_DEBUG("USART6 Processing test_message parameter\r\n");
                     // Move to test message value
                     err = cbor_value_advance(&params_map);
                     if (err != CborNoError) {
-                        printf("USART6 DEBUG: Error advancing to test message value: %d\r\n", err);
+                        LOG_DEBUG("USART6 Error advancing to test message value: %d\r\n", err);
                         return err;
                     }
 
                     // Process test message
                     if (!cbor_value_is_text_string(&params_map)) {
-                        printf("USART6 DEBUG: Test message is not a text string\r\n");
+                        LOG_DEBUG("USART6 Test message is not a text string\r\n");
                         send_cbor_response("error", "Test message must be a string");
                         return CborErrorIllegalType;
                     }
@@ -316,23 +722,23 @@ static CborError handle_test_method(CborValue *map_value)
                     size_t test_message_length = sizeof(test_message);
                     err = cbor_value_copy_text_string(&params_map, test_message, &test_message_length, NULL);
                     if (err != CborNoError) {
-                        printf("USART6 DEBUG: Error copying test message: %d\r\n", err);
+                        LOG_DEBUG("USART6 Error copying test message: %d\r\n", err);
                         send_cbor_response("error", "Failed to read test message");
                         return err;
                     }
 
-                    printf("USART6 Received test message: %s\r\n", test_message);
+                    LOG_DEBUG("USART6 Received test message: %s\r\n", test_message);
                     found_test_message = true;
 
                     // Continue parsing to look for additional parameters
                     err = cbor_value_advance(&params_map);
                     if (err != CborNoError) {
-                        printf("USART6 DEBUG: Error advancing after test message: %d\r\n", err);
+                        LOG_DEBUG("USART6 Error advancing after test message: %d\r\n", err);
                         return err;
                     }
                 }
                 else {
-                    printf("USART6 DEBUG: Skipping unknown test parameter: %s\r\n", param_name);
+                    LOG_DEBUG("USART6 Skipping unknown test parameter: %s\r\n", param_name);
                     SKIP_KEY_VALUE_PAIR(&params_map);
                 }
             }
@@ -341,7 +747,7 @@ static CborError handle_test_method(CborValue *map_value)
                 send_test_response("success", "Test RPC call processed successfully", test_message);
             }
             else {
-                printf("USART6 DEBUG: No test_message parameter found\r\n");
+                LOG_DEBUG("USART6 No test_message parameter found\r\n");
                 send_cbor_response("error", "No test_message parameter found");
                 return CborErrorUnknownType;
             }
@@ -349,19 +755,19 @@ static CborError handle_test_method(CborValue *map_value)
             return CborNoError;
         }
         else {
-            printf("USART6 DEBUG: Skipping unknown test method handler key: %s\r\n", key_name);
+            LOG_DEBUG("USART6 Skipping unknown test method handler key: %s\r\n", key_name);
             SKIP_KEY_VALUE_PAIR(map_value);
         }
     }
 
-    printf("USART6 DEBUG: Params not found in test method call\r\n");
+    LOG_DEBUG("USART6 Params not found in test method call\r\n");
     send_cbor_response("error", "Params not found in test method call");
     return CborErrorUnknownType;
 }
 
 static CborError handle_clear_display_method(CborValue *map_value)
 {
-    printf("USART6 DEBUG: Handling clear_display method\r\n");
+    LOG_DEBUG("USART6 Handling clear_display method\r\n");
 
     // Clear the image buffer and update display
     clear_image_buffer();
@@ -375,13 +781,13 @@ static CborError handle_clear_display_method(CborValue *map_value)
 
 static CborError handle_display_default_method(CborValue *map_value)
 {
-    printf("USART6 DEBUG: Handling display_default method\r\n");
+    LOG_DEBUG("USART6 Handling display_default method\r\n");
 
-    // Display the default image
-    display_default_image();
+    // Queue the default image, DMA2D draws it while the response goes out
+    display_default_image(NULL, NULL);
 
     // Send success response
-    send_cbor_response("success", "Default image displayed successfully");
+    send_cbor_response("success", "Default image queued successfully");
 
     return CborNoError;
 }
@@ -390,11 +796,11 @@ static CborError handle_display_image_method(CborValue *map_value)
 {
     CborError err;
 
-    printf("USART6 DEBUG: Handling display_image method\r\n");
+    LOG_DEBUG("USART6 Handling display_image method\r\n");
 
     while (!cbor_value_at_end(map_value)) {
         if (!cbor_value_is_text_string(map_value)) {
-            printf("USART6 DEBUG: Skipping non-text key in method handler\r\n");
+            LOG_DEBUG("USART6 Skipping non-text key in method handler\r\n");
             SKIP_KEY_VALUE_PAIR(map_value);
         }
 
@@ -402,203 +808,1374 @@ static CborError handle_display_image_method(CborValue *map_value)
         size_t key_length = sizeof(key_name);
         err = cbor_value_copy_text_string(map_value, key_name, &key_length, NULL);
         if (err != CborNoError) {
-            printf("USART6 DEBUG: Error reading method handler key: %d\r\n", err);
+            LOG_DEBUG("USART6 Error reading method handler key: %d\r\n", err);
             return err;
         }
 
-        printf("USART6 DEBUG: Found method handler key: %s\r\n", key_name);
+        LOG_DEBUG("USART6 Found method handler key: %s\r\n", key_name);
 
         if (strcmp(key_name, "params") == 0) {
-            printf("USART6 DEBUG: Found params field\r\n");
+            LOG_DEBUG("USART6 Found params field\r\n");
             // Move to params value
             err = cbor_value_advance(map_value);
             if (err != CborNoError) {
-                printf("USART6 DEBUG: Error advancing to params value: %d\r\n", err);
+                LOG_DEBUG("USART6 Error advancing to params value: %d\r\n", err);
                 return err;
             }
 
             // Enter params map
             if (!cbor_value_is_map(map_value)) {
-                printf("USART6 DEBUG: Params is not a map\r\n");
+                LOG_DEBUG("USART6 Params is not a map\r\n");
                 send_cbor_response("error", "Params must be a map");
                 return CborErrorIllegalType;
             }
 
-            printf("USART6 DEBUG: Params is a map - good\r\n");
+            LOG_DEBUG("USART6 Params is a map - good\r\n");
 
             CborValue params_map;
             err = cbor_value_enter_container(map_value, &params_map);
             if (err != CborNoError) {
-                printf("USART6 DEBUG: Error entering params container: %d\r\n", err);
+                LOG_DEBUG("USART6 Error entering params container: %d\r\n", err);
                 send_cbor_response("error", "Failed to parse params");
                 return err;
             }
 
-            printf("USART6 DEBUG: Entered params container, calling process_display_params\r\n");
+            LOG_DEBUG("USART6 Entered params container, calling process_display_params\r\n");
             return process_display_params(&params_map);
         }
         else {
-            printf("USART6 DEBUG: Skipping unknown method handler key: %s\r\n", key_name);
+            LOG_DEBUG("USART6 Skipping unknown method handler key: %s\r\n", key_name);
             SKIP_KEY_VALUE_PAIR(map_value);
         }
     }
 
-    printf("USART6 DEBUG: Params not found in method call\r\n");
+    LOG_DEBUG("USART6 Params not found in method call\r\n");
     send_cbor_response("error", "Params not found in method call");
     return CborErrorUnknownType;
 }
 
-static CborError process_cbor_rpc_message(const uint8_t *cbor_data, size_t data_length)
+// Returns the offset of the first block not yet received, or image_upload_size when the upload is complete
+static uint32_t image_upload_first_missing(void)
 {
-    printf("USART6 DEBUG: Starting CBOR RPC message processing, length: %zu\r\n", data_length);
+    uint32_t block_count = (image_upload_size + IMAGE_CHUNK_BLOCK_SIZE - 1) / IMAGE_CHUNK_BLOCK_SIZE;
 
-    // Parse the CBOR message
-    CborParser parser;
-    CborValue value;
+    for (uint32_t block = 0; block < block_count; block++) {
+        if ((image_upload_blocks[block / 32] & (1u << (block % 32))) == 0) {
+            return block * IMAGE_CHUNK_BLOCK_SIZE;
+        }
+    }
 
-    CborError err = cbor_parser_init(cbor_data, data_length, 0, &parser, &value);
+    return image_upload_size;
+}
+
+static CborError handle_image_begin_method(CborValue *map_value)
+{
+    CborValue params_map;
+    CborValue size_value;
+    uint32_t size = IMAGE_DATA_SIZE;
+
+    LOG_DEBUG("USART6 Handling image_begin method\r\n");
+
+    // The size is optional, an upload covers a whole frame by default
+    if (enter_params_map(map_value, &params_map) == CborNoError &&
+        find_param(&params_map, "size", &size_value) == CborNoError) {
+        if (read_uint32(&size_value, &size) != CborNoError || size == 0 || size > IMAGE_DATA_SIZE) {
+            LOG_DEBUG("USART6 Invalid image upload size\r\n");
+            send_cbor_response("error", "Invalid image size");
+            return CborErrorIllegalType;
+        }
+    }
+
+    image_upload_active = true;
+    image_upload_size = size;
+    memset(image_upload_blocks, 0, sizeof(image_upload_blocks));
+
+    LOG_DEBUG("USART6 Image upload started, size: %lu bytes\r\n", size);
+    send_cbor_response("success", "Image upload started");
+
+    return CborNoError;
+}
+
+static CborError handle_image_chunk_method(CborValue *map_value)
+{
+    CborError err;
+    CborValue params_map;
+    CborValue offset_value;
+    CborValue data_value;
+    uint32_t offset;
+    size_t length;
+
+    if (!image_upload_active) {
+        LOG_DEBUG("USART6 image_chunk without image_begin\r\n");
+        send_cbor_response("error", "No image upload in progress");
+        return CborErrorUnknownType;
+    }
+
+    err = enter_params_map(map_value, &params_map);
+    if (err == CborNoError) {
+        err = find_param(&params_map, "offset", &offset_value);
+    }
+    if (err == CborNoError) {
+        err = read_uint32(&offset_value, &offset);
+    }
     if (err != CborNoError) {
-        printf("USART6 Error parsing CBOR: %d\r\n", err);
-        printf("USART6 DEBUG: CBOR parser init failed\r\n");
-        send_cbor_response("error", "Failed to parse CBOR message");
+        LOG_DEBUG("USART6 Chunk offset missing or invalid\r\n");
+        send_cbor_response("error", "Missing or invalid chunk offset");
         return err;
     }
 
-    printf("USART6 DEBUG: CBOR parser initialized successfully\r\n");
-
-    // Expect a map (RPC message)
-    if (!cbor_value_is_map(&value)) {
-        printf("USART6 Error: Expected map, got type %d\r\n", value.type);
-        printf("USART6 DEBUG: Root value is not a map\r\n");
-        send_cbor_response("error", "Expected RPC message format");
+    // Chunks start on a block boundary and cover whole blocks, except for the one that ends the image
+    err = find_param(&params_map, "data", &data_value);
+    if (err != CborNoError || !cbor_value_is_byte_string(&data_value) ||
+        cbor_value_get_string_length(&data_value, &length) != CborNoError || length == 0 ||
+        offset % IMAGE_CHUNK_BLOCK_SIZE != 0 || offset >= image_upload_size || length > image_upload_size - offset ||
+        (length % IMAGE_CHUNK_BLOCK_SIZE != 0 && offset + length != image_upload_size)) {
+        LOG_DEBUG("USART6 Invalid image chunk at offset %lu\r\n", offset);
+        send_offset_response("error", "Invalid image chunk", offset);
         return CborErrorIllegalType;
     }
 
-    printf("USART6 DEBUG: Root value is a map - good\r\n");
-
-    // Enter the map
-    CborValue map_value;
-    err = cbor_value_enter_container(&value, &map_value);
+    err = cbor_value_copy_byte_string(&data_value, get_image_buffer(image_upload_size) + offset, &length, NULL);
     if (err != CborNoError) {
-        printf("USART6 Error entering map: %d\r\n", err);
-        printf("USART6 DEBUG: Failed to enter map container\r\n");
-        send_cbor_response("error", "Failed to parse message structure");
+        LOG_DEBUG("USART6 Error copying image chunk: %d\r\n", err);
+        send_offset_response("error", "Failed to read chunk data", offset);
         return err;
     }
 
-    printf("USART6 DEBUG: Entered map container successfully\r\n");
+    for (uint32_t block = offset / IMAGE_CHUNK_BLOCK_SIZE;
+         block < (offset + length + IMAGE_CHUNK_BLOCK_SIZE - 1) / IMAGE_CHUNK_BLOCK_SIZE; block++) {
+        image_upload_blocks[block / 32] |= 1u << (block % 32);
+    }
 
-    // Look for "method" field and determine which method to call
-    char method_name[32];
-    bool found_method = false;
+    LOG_DEBUG("USART6 Image chunk stored, offset: %lu, length: %zu\r\n", offset, length);
+    send_offset_response("success", "Chunk received", offset);
 
-    printf("USART6 DEBUG: Searching for method field\r\n");
+    return CborNoError;
+}
 
-    while (!cbor_value_at_end(&map_value)) {
-        if (!cbor_value_is_text_string(&map_value)) {
-            printf("USART6 DEBUG: Skipping non-text key in root map\r\n");
-            SKIP_KEY_VALUE_PAIR(&map_value);
-        }
+static CborError handle_image_commit_method(CborValue *map_value)
+{
+    (void) map_value; // Suppress unused parameter warning
+    LOG_DEBUG("USART6 Handling image_commit method\r\n");
 
-        char key_name[32];
-        size_t key_length = sizeof(key_name);
-        err = cbor_value_copy_text_string(&map_value, key_name, &key_length, NULL);
-        if (err != CborNoError) {
-            printf("USART6 DEBUG: Error reading root map key: %d\r\n", err);
-            return err;
-        }
+    if (!image_upload_active) {
+        send_cbor_response("error", "No image upload in progress");
+        return CborErrorUnknownType;
+    }
 
-        printf("USART6 DEBUG: Found root map key: %s\r\n", key_name);
+    // Report the first gap so the host can resend it, the upload stays open until it is complete
+    uint32_t missing = image_upload_first_missing();
+    if (missing < image_upload_size) {
+        LOG_DEBUG("USART6 Image upload incomplete, first missing offset: %lu\r\n", missing);
+        send_offset_response("error", "Missing image chunks", missing);
+        return CborErrorUnknownType;
+    }
 
-        if (strcmp(key_name, "method") == 0) {
-            printf("USART6 DEBUG: Found method field\r\n");
-            // Move to value
-            err = cbor_value_advance(&map_value);
-            if (err != CborNoError) {
-                printf("USART6 DEBUG: Error advancing to method value: %d\r\n", err);
-                return err;
-            }
+    image_upload_active = false;
+    update_display();
 
-            // Read method value
-            if (!cbor_value_is_text_string(&map_value)) {
-                printf("USART6 DEBUG: Method value is not a string\r\n");
-                send_cbor_response("error", "Method must be a string");
-                return CborErrorIllegalType;
-            }
+    send_offset_response("success", "Image displayed successfully", image_upload_size);
 
-            size_t method_length = sizeof(method_name);
-            err = cbor_value_copy_text_string(&map_value, method_name, &method_length, NULL);
-            if (err != CborNoError) {
-                printf("USART6 DEBUG: Error reading method value: %d\r\n", err);
-                return err;
-            }
+    return CborNoError;
+}
 
-            printf("USART6 DEBUG: Method value: %s\r\n", method_name);
-            found_method = true;
-            break;
-        }
+// Reads one {x, y, width, height, data} rectangle and checks that it fits the framebuffer
+static CborError read_region(const CborValue *region_map, uint32_t region[4], const uint8_t **data)
+{
+    static const char *const names[4] = {"x", "y", "width", "height"};
+    CborValue fields;
+    CborValue value;
+    size_t length;
 
-        // Move to next key-value pair
-        err = cbor_value_advance(&map_value);
-        if (err != CborNoError) {
-            printf("USART6 DEBUG: Error advancing to next key: %d\r\n", err);
-            return err;
+    if (!cbor_value_is_map(region_map)) {
+        return CborErrorIllegalType;
+    }
+
+    CborError err = cbor_value_enter_container(region_map, &fields);
+    if (err != CborNoError) {
+        return err;
+    }
+
+    for (int i = 0; i < 4; i++) {
+        err = find_param(&fields, names[i], &value);
+        if (err == CborNoError) {
+            err = read_uint32(&value, &region[i]);
         }
-        err = cbor_value_advance(&map_value);
         if (err != CborNoError) {
-            printf("USART6 DEBUG: Error advancing to next value: %d\r\n", err);
             return err;
         }
     }
 
-    if (!found_method) {
-        printf("USART6 DEBUG: Method field not found\r\n");
-        send_cbor_response("error", "Method field not found in RPC message");
-        return CborErrorUnknownType;
+    err = find_param(&fields, "data", &value);
+    if (err == CborNoError) {
+        err = get_byte_string(&value, data, &length);
+    }
+    if (err != CborNoError) {
+        return err;
+    }
+
+    if (region[2] == 0 || region[3] == 0 || region[0] >= IMAGE_WIDTH || region[1] >= IMAGE_HEIGHT ||
+        region[2] > IMAGE_WIDTH - region[0] || region[3] > IMAGE_HEIGHT - region[1] ||
+        length != region[2] * region[3] * sizeof(uint16_t)) {
+        return CborErrorDataTooLarge;
+    }
+
+    return CborNoError;
+}
+
+// Draws an array of regions into the back buffer, validating every rectangle before writing any of them so a bad
+// request leaves the screen untouched
+static CborError draw_regions(const CborValue *regions, size_t *count)
+{
+    CborValue region_map;
+    uint32_t region[4];
+    const uint8_t *data;
+
+    *count = 0;
+    CborError err = cbor_value_enter_container(regions, &region_map);
+    while (err == CborNoError && !cbor_value_at_end(&region_map)) {
+        err = read_region(&region_map, region, &data);
+        if (err == CborNoError) {
+            err = cbor_value_advance(&region_map);
+        }
+        (*count)++;
+    }
+    if (err != CborNoError) {
+        LOG_DEBUG("USART6 Invalid region %zu: %d\r\n", *count, err);
+        return err;
+    }
+
+    cbor_value_enter_container(regions, &region_map);
+    while (!cbor_value_at_end(&region_map)) {
+        read_region(&region_map, region, &data);
+        display_region(region[0], region[1], region[2], region[3], data);
+        cbor_value_advance(&region_map);
+    }
+
+    // The copies read from cbor_buffer, which the next message overwrites
+    gfx_wait();
+
+    return CborNoError;
+}
+
+static CborError handle_display_region_method(CborValue *map_value)
+{
+    CborError err;
+    CborValue params_map;
+    CborValue regions;
+    size_t count = 0;
+
+    LOG_DEBUG("USART6 Handling display_region method\r\n");
+
+    err = enter_params_map(map_value, &params_map);
+    if (err == CborNoError) {
+        err = find_param(&params_map, "regions", &regions);
+    }
+    if (err != CborNoError || !cbor_value_is_array(&regions)) {
+        LOG_DEBUG("USART6 display_region without a regions array\r\n");
+        send_cbor_response("error", "Regions must be an array");
+        return CborErrorIllegalType;
+    }
+
+    err = draw_regions(&regions, &count);
+    if (err != CborNoError) {
+        send_cbor_response("error", "Invalid region");
+        return err;
+    }
+
+    // With nothing drawn the back buffer may hold an older frame
+    if (count > 0) {
+        update_display();
+    }
+
+    LOG_DEBUG("USART6 %zu regions displayed\r\n", count);
+    send_cbor_response("success", "Regions displayed successfully");
+
+    return CborNoError;
+}
+
+static CborError handle_show_slot_method(CborValue *map_value)
+{
+    static const char *const names[1] = {"slot"};
+    uint32_t slot;
+
+    LOG_DEBUG("USART6 Handling show_slot method\r\n");
+
+    CborError err = read_uint32_params(map_value, names, &slot, 1);
+    if (err != CborNoError || slot >= IMAGE_SLOT_COUNT) {
+        LOG_DEBUG("USART6 Invalid show_slot params\r\n");
+        send_cbor_response("error", "Invalid slot");
+        return err != CborNoError ? err : CborErrorDataTooLarge;
+    }
+
+    // The switch happens at the next vertical blanking, the response does not wait for it
+    if (!show_slot(slot)) {
+        send_cbor_response("error", "Slot is empty");
+        return CborNoError;
+    }
+
+    send_cbor_response("success", "Slot shown successfully");
+
+    return CborNoError;
+}
+
+static CborError handle_overlay_move_method(CborValue *map_value)
+{
+    static const char *const names[2] = {"x", "y"};
+    uint32_t position[2];
+
+    LOG_DEBUG("USART6 Handling overlay_move method\r\n");
+
+    CborError err = read_uint32_params(map_value, names, position, 2);
+    if (err != CborNoError || position[0] >= IMAGE_WIDTH || position[1] >= IMAGE_HEIGHT ||
+        !overlay_move(position[0], position[1])) {
+        send_cbor_response("error", "Invalid overlay position");
+        return err != CborNoError ? err : CborErrorDataTooLarge;
+    }
+
+    send_cbor_response("success", "Overlay moved successfully");
+
+    return CborNoError;
+}
+
+static CborError handle_overlay_alpha_method(CborValue *map_value)
+{
+    static const char *const names[1] = {"alpha"};
+    uint32_t alpha;
+
+    LOG_DEBUG("USART6 Handling overlay_alpha method\r\n");
+
+    CborError err = read_uint32_params(map_value, names, &alpha, 1);
+    if (err != CborNoError || alpha > 255) {
+        send_cbor_response("error", "Invalid overlay alpha");
+        return err != CborNoError ? err : CborErrorDataTooLarge;
+    }
+
+    overlay_set_alpha(alpha);
+    send_cbor_response("success", "Overlay alpha set successfully");
+
+    return CborNoError;
+}
+
+static CborError handle_overlay_color_key_method(CborValue *map_value)
+{
+    static const char *const names[1] = {"color"};
+    CborValue params_map;
+    CborValue enabled_value;
+    uint32_t color = 0;
+    bool enabled = false;
+
+    LOG_DEBUG("USART6 Handling overlay_color_key method\r\n");
+
+    // The colour is only needed to turn keying on
+    CborError err = enter_params_map(map_value, &params_map);
+    if (err == CborNoError) {
+        err = find_param(&params_map, "enabled", &enabled_value);
+    }
+    if (err == CborNoError) {
+        err = cbor_value_is_boolean(&enabled_value) ? cbor_value_get_boolean(&enabled_value, &enabled)
+                                                    : CborErrorIllegalType;
+    }
+    if (err == CborNoError && enabled) {
+        err = read_uint32_params(map_value, names, &color, 1);
+    }
+    if (err != CborNoError || color > 0xFFFF) {
+        send_cbor_response("error", "Invalid colour key");
+        return err != CborNoError ? err : CborErrorDataTooLarge;
+    }
+
+    overlay_set_color_key(enabled, color);
+    send_cbor_response("success", "Overlay colour key set successfully");
+
+    return CborNoError;
+}
+
+static CborError handle_draw_asset_method(CborValue *map_value)
+{
+    static const char *const names[3] = {"id", "x", "y"};
+    uint32_t fields[3];
+    uint32_t color = 0xFFFFFFFF;
+
+    LOG_DEBUG("USART6 Handling draw_asset method\r\n");
+
+    // The colour (ARGB8888) is optional, it tints A8/A4 assets and its alpha fades any blended asset
+    CborError err = read_uint32_params(map_value, names, fields, 3);
+    if (err == CborNoError) {
+        err = read_optional_uint32(map_value, "color", &color);
+    }
+    if (err != CborNoError || fields[1] >= IMAGE_WIDTH || fields[2] >= IMAGE_HEIGHT) {
+        send_cbor_response("error", "Invalid draw_asset params");
+        return err != CborNoError ? err : CborErrorDataTooLarge;
+    }
+
+    if (!asset_draw(fields[0], fields[1], fields[2], color)) {
+        send_cbor_response("error", "Unknown asset or asset does not fit");
+        return CborNoError;
+    }
+
+    // The blit runs on DMA2D and the swap waits for it
+    update_display();
+    send_cbor_response("success", "Asset drawn successfully");
+
+    return CborNoError;
+}
+
+static CborError handle_draw_text_method(CborValue *map_value)
+{
+    static const char *const names[4] = {"x", "y", "font", "color"};
+    uint32_t fields[4];
+    CborValue params_map;
+    CborValue text_value;
+    const uint8_t *text = NULL;
+    size_t length = 0;
+
+    LOG_DEBUG("USART6 Handling draw_text method\r\n");
+
+    CborError err = read_uint32_params(map_value, names, fields, 4);
+    if (err == CborNoError) {
+        err = enter_params_map(map_value, &params_map);
+    }
+    if (err == CborNoError) {
+        err = find_param(&params_map, "text", &text_value);
+    }
+    if (err == CborNoError) {
+        err = cbor_value_is_text_string(&text_value) ? get_string_data(&text_value, &text, &length)
+                                                     : CborErrorIllegalType;
+    }
+    if (err != CborNoError || fields[3] > 0xFFFF) {
+        send_cbor_response("error", "Invalid draw_text params");
+        return err != CborNoError ? err : CborErrorDataTooLarge;
+    }
+
+    if (!text_draw(fields[0], fields[1], fields[2], fields[3], (const char *) text, length)) {
+        send_cbor_response("error", "Unknown font or text does not fit");
+        return CborNoError;
+    }
+
+    // The glyphs are blended from flash by DMA2D and the swap waits for them
+    update_display();
+    send_cbor_response("success", "Text drawn successfully");
+
+    return CborNoError;
+}
+
+static CborError handle_asset_clear_method(CborValue *map_value)
+{
+    (void) map_value; // Suppress unused parameter warning
+    LOG_DEBUG("USART6 Handling asset_clear method\r\n");
+
+    asset_clear();
+    send_cbor_response("success", "Assets cleared successfully");
+
+    return CborNoError;
+}
+
+// Display list commands, all parsed and checked before any of them runs
+static render_command_t render_commands[RENDER_MAX_COMMANDS];
+
+// Reads one [op, integer args..., optional byte or text string] command
+static CborError read_render_command(const CborValue *command_value, render_command_t *command)
+{
+    CborValue item;
+    char op_name[16];
+    size_t op_length = sizeof(op_name);
+
+    if (!cbor_value_is_array(command_value)) {
+        return CborErrorIllegalType;
+    }
+
+    CborError err = cbor_value_enter_container(command_value, &item);
+    if (err == CborNoError && !cbor_value_is_text_string(&item)) {
+        err = CborErrorIllegalType;
+    }
+    if (err == CborNoError) {
+        err = cbor_value_copy_text_string(&item, op_name, &op_length, &item);
     }
-
-    printf("USART6 DEBUG: Method validation passed, processing method: %s\r\n", method_name);
-
-    // Reset to beginning of map to process the full message
-    err = cbor_value_enter_container(&value, &map_value);
     if (err != CborNoError) {
-        printf("USART6 DEBUG: Error re-entering map container: %d\r\n", err);
         return err;
     }
+    if (!render_find_op(op_name, &command->op)) {
+        return CborErrorUnknownType;
+    }
+
+    command->arg_count = 0;
+    command->data = NULL;
+    command->data_length = 0;
+
+    // The string, if any, comes after the integers
+    while (!cbor_value_at_end(&item)) {
+        if (command->data != NULL) {
+            return CborErrorDataTooLarge;
+        }
+        else if (cbor_value_is_byte_string(&item) || cbor_value_is_text_string(&item)) {
+            err = get_string_data(&item, &command->data, &command->data_length);
+        }
+        else if (command->arg_count < RENDER_MAX_ARGS) {
+            err = read_uint32(&item, &command->args[command->arg_count++]);
+        }
+        else {
+            return CborErrorDataTooLarge;
+        }
+
+        if (err == CborNoError) {
+            err = cbor_value_advance(&item);
+        }
+        if (err != CborNoError) {
+            return err;
+        }
+    }
+
+    return render_check(command) ? CborNoError : CborErrorDataTooLarge;
+}
+
+static CborError handle_render_method(CborValue *map_value)
+{
+    CborValue params_map;
+    CborValue commands;
+    CborValue command_value;
+    size_t count = 0;
+
+    LOG_DEBUG("USART6 Handling render method\r\n");
+
+    CborError err = enter_params_map(map_value, &params_map);
+    if (err == CborNoError) {
+        err = find_param(&params_map, "commands", &commands);
+    }
+    if (err != CborNoError || !cbor_value_is_array(&commands)) {
+        LOG_DEBUG("USART6 render without a commands array\r\n");
+        send_cbor_response("error", "Commands must be an array");
+        return err != CborNoError ? err : CborErrorIllegalType;
+    }
+
+    // Parse the whole list first so a bad command leaves the screen untouched
+    err = cbor_value_enter_container(&commands, &command_value);
+    while (err == CborNoError && !cbor_value_at_end(&command_value)) {
+        if (count == RENDER_MAX_COMMANDS) {
+            err = CborErrorDataTooLarge;
+            break;
+        }
+
+        err = read_render_command(&command_value, &render_commands[count]);
+        if (err == CborNoError) {
+            err = cbor_value_advance(&command_value);
+        }
+        count++;
+    }
+    if (err != CborNoError) {
+        LOG_DEBUG("USART6 Invalid render command %zu: %d\r\n", count, err);
+        send_cbor_response("error", "Invalid render command");
+        return err;
+    }
+
+    render_execute(render_commands, count);
+
+    // Region data and text are read from cbor_buffer, which the next message overwrites
+    gfx_wait();
+
+    LOG_DEBUG("USART6 %zu render commands queued\r\n", count);
+    send_cbor_response("success", "Rendered successfully");
+
+    return CborNoError;
+}
+
+// Samples of one plot_append, kept out of the stack
+static int32_t plot_samples[PLOT_MAX_SAMPLES];
+
+static CborError handle_plot_create_method(CborValue *map_value)
+{
+    static const char *const names[6] = {"id", "x", "y", "width", "height", "color"};
+    uint32_t fields[6];
+    uint32_t background = 0x0000;
+    int32_t range[2];
+    CborValue params_map;
+    CborValue value;
+
+    LOG_DEBUG("USART6 Handling plot_create method\r\n");
+
+    CborError err = read_uint32_params(map_value, names, fields, 6);
+    if (err == CborNoError) {
+        err = read_optional_uint32(map_value, "background", &background);
+    }
+    if (err == CborNoError) {
+        err = enter_params_map(map_value, &params_map);
+    }
+    for (int i = 0; i < 2 && err == CborNoError; i++) {
+        err = find_param(&params_map, i == 0 ? "min" : "max", &value);
+        if (err == CborNoError) {
+            err = read_int32(&value, &range[i]);
+        }
+    }
+    if (err != CborNoError || fields[1] >= IMAGE_WIDTH || fields[2] >= IMAGE_HEIGHT || fields[3] > IMAGE_WIDTH ||
+        fields[4] > IMAGE_HEIGHT || fields[5] > 0xFFFF || background > 0xFFFF) {
+        send_cbor_response("error", "Invalid plot_create params");
+        return err != CborNoError ? err : CborErrorDataTooLarge;
+    }
+
+    if (!plot_create(fields[0], fields[1], fields[2], fields[3], fields[4], range[0], range[1], fields[5],
+                     background)) {
+        send_cbor_response("error", "Invalid plot ID, rectangle or range");
+        return CborNoError;
+    }
+
+    update_display();
+    send_cbor_response("success", "Plot created successfully");
+
+    return CborNoError;
+}
+
+static CborError handle_plot_append_method(CborValue *map_value)
+{
+    static const char *const names[1] = {"id"};
+    uint32_t id;
+    CborValue params_map;
+    CborValue samples;
+    CborValue sample;
+    size_t count = 0;
+
+    LOG_DEBUG("USART6 Handling plot_append method\r\n");
+
+    CborError err = read_uint32_params(map_value, names, &id, 1);
+    if (err == CborNoError) {
+        err = enter_params_map(map_value, &params_map);
+    }
+    if (err == CborNoError) {
+        err = find_param(&params_map, "samples", &samples);
+    }
+    if (err == CborNoError) {
+        err = cbor_value_is_array(&samples) ? cbor_value_enter_container(&samples, &sample) : CborErrorIllegalType;
+    }
+    while (err == CborNoError && !cbor_value_at_end(&sample)) {
+        if (count == PLOT_MAX_SAMPLES) {
+            err = CborErrorDataTooLarge;
+            break;
+        }
+
+        err = read_int32(&sample, &plot_samples[count++]);
+        if (err == CborNoError) {
+            err = cbor_value_advance(&sample);
+        }
+    }
+    if (err != CborNoError) {
+        send_cbor_response("error", "Invalid plot_append params");
+        return err;
+    }
+
+    if (!plot_append(id, plot_samples, count)) {
+        send_cbor_response("error", "Unknown plot");
+        return CborNoError;
+    }
+
+    // The scroll and the new columns run on DMA2D and the swap waits for them
+    update_display();
+    send_cbor_response("success", "Samples appended successfully");
+
+    return CborNoError;
+}
+
+static CborError handle_play_method(CborValue *map_value)
+{
+    static const char *const names[1] = {"fps"};
+    static uint8_t slots[PLAYBACK_MAX_FRAMES];
+    uint32_t fps;
+    bool loop = true;
+    size_t count = 0;
+    CborValue params_map;
+    CborValue value;
+    CborValue frame;
+
+    LOG_DEBUG("USART6 Handling play method\r\n");
+
+    CborError err = read_uint32_params(map_value, names, &fps, 1);
+    if (err == CborNoError) {
+        err = enter_params_map(map_value, &params_map);
+    }
+
+    // Sequences loop unless told otherwise
+    if (err == CborNoError && find_param(&params_map, "loop", &value) == CborNoError) {
+        err = cbor_value_is_boolean(&value) ? cbor_value_get_boolean(&value, &loop) : CborErrorIllegalType;
+    }
+
+    if (err == CborNoError) {
+        err = find_param(&params_map, "sequence", &value);
+    }
+    if (err == CborNoError) {
+        err = cbor_value_is_array(&value) ? cbor_value_enter_container(&value, &frame) : CborErrorIllegalType;
+    }
+    while (err == CborNoError && !cbor_value_at_end(&frame)) {
+        uint32_t slot;
+
+        if (count == PLAYBACK_MAX_FRAMES) {
+            err = CborErrorDataTooLarge;
+            break;
+        }
+
+        err = read_uint32(&frame, &slot);
+        if (err == CborNoError) {
+            err = slot < IMAGE_SLOT_COUNT ? cbor_value_advance(&frame) : CborErrorDataTooLarge;
+        }
+        slots[count++] = (uint8_t) slot;
+    }
+    if (err != CborNoError) {
+        send_cbor_response("error", "Invalid play params");
+        return err;
+    }
+
+    if (!playback_start(slots, count, fps, loop)) {
+        send_cbor_response("error", "Empty slot in sequence or invalid frame rate");
+        return CborNoError;
+    }
+
+    send_cbor_response("success", "Playback started");
+
+    return CborNoError;
+}
+
+static CborError handle_play_stop_method(CborValue *map_value)
+{
+    (void) map_value; // Suppress unused parameter warning
+    LOG_DEBUG("USART6 Handling play_stop method\r\n");
+
+    // The frame on screen stays up
+    playback_stop();
+    send_cbor_response("success", "Playback stopped");
+
+    return CborNoError;
+}
+
+// Reads one stage's histogram, then clears them all if asked so the next reading starts afresh
+static CborError handle_get_profile_method(CborValue *map_value)
+{
+    uint32_t stage = 0;
+    bool reset = false;
+    CborValue params_map;
+    CborValue value;
+
+    LOG_DEBUG("USART6 Handling get_profile method\r\n");
+
+    CborError err = read_optional_uint32(map_value, "stage", &stage);
+    if (err == CborNoError) {
+        err = enter_params_map(map_value, &params_map);
+    }
+    if (err == CborNoError && find_param(&params_map, "reset", &value) == CborNoError) {
+        err = cbor_value_is_boolean(&value) ? cbor_value_get_boolean(&value, &reset) : CborErrorIllegalType;
+    }
+    if (err != CborNoError) {
+        send_cbor_response("error", "Invalid get_profile params");
+        return err;
+    }
+
+    if (stage >= PROFILE_STAGE_COUNT) {
+        send_cbor_response("error", "Unknown profile stage");
+        return CborNoError;
+    }
+
+    send_profile_response((profile_stage_t) stage);
+
+    if (reset) {
+        profile_reset();
+    }
+
+    return CborNoError;
+}
+
+// Shows a stream frame that has been drawn into the back buffer and updates the frame rate. A frame with nothing
+// changed is already on screen, and swapping in a back buffer nothing was drawn into would bring back an older one.
+static void stream_present(uint32_t seq, bool changed)
+{
+    uint32_t now = HAL_GetTick();
+
+    if (changed) {
+        update_display();
+    }
+
+    stream_session.frames++;
+    stream_session.window_frames++;
+    if (now - stream_session.window_tick >= STREAM_FPS_WINDOW_MS) {
+        stream_session.fps = stream_session.window_frames * 1000.0f / (now - stream_session.window_tick);
+        stream_session.window_tick = now;
+        stream_session.window_frames = 0;
+    }
+
+    send_stream_ack("success", "Frame shown", seq);
+}
+
+static CborError handle_stream_begin_method(CborValue *map_value)
+{
+    uint32_t credits = STREAM_MAX_CREDITS;
+
+    LOG_DEBUG("USART6 Handling stream_begin method\r\n");
+
+    CborError err = read_optional_uint32(map_value, "credits", &credits);
+    if (err != CborNoError || credits == 0) {
+        send_cbor_response("error", "Invalid stream_begin params");
+        return err != CborNoError ? err : CborErrorDataTooLarge;
+    }
+
+    // Asking for more credits than there are response slots gets the most the device can acknowledge
+    stream_session = (stream_session_t) {
+        .active = true,
+        .credits = credits < STREAM_MAX_CREDITS ? credits : STREAM_MAX_CREDITS,
+        .start_tick = HAL_GetTick(),
+        .window_tick = HAL_GetTick(),
+    };
+
+    send_stream_summary("Stream started");
+
+    return CborNoError;
+}
+
+// Delta frames: the regions that changed since the previous frame, drawn over it
+static CborError handle_stream_frame_method(CborValue *map_value)
+{
+    static const char *const names[1] = {"seq"};
+    uint32_t seq;
+    CborValue params_map;
+    CborValue regions;
+    size_t count;
+
+    CborError err = read_uint32_params(map_value, names, &seq, 1);
+    if (err == CborNoError) {
+        err = enter_params_map(map_value, &params_map);
+    }
+    if (err == CborNoError) {
+        err = find_param(&params_map, "regions", &regions);
+    }
+    if (err != CborNoError || !cbor_value_is_array(&regions) || !stream_session.active) {
+        send_cbor_response("error", "Invalid stream frame");
+        return err != CborNoError ? err : CborErrorIllegalType;
+    }
+
+    err = draw_regions(&regions, &count);
+    if (err != CborNoError) {
+        send_stream_ack("error", "Invalid region", seq);
+        return err;
+    }
+
+    stream_present(seq, count > 0);
+
+    return CborNoError;
+}
+
+static CborError handle_stream_end_method(CborValue *map_value)
+{
+    (void) map_value; // Suppress unused parameter warning
+    LOG_DEBUG("USART6 Handling stream_end method\r\n");
+
+    if (!stream_session.active) {
+        send_cbor_response("error", "No stream to end");
+        return CborNoError;
+    }
+
+    stream_session.active = false;
+    LOG_INFO("USART6 Stream ended: %lu frames shown\r\n", stream_session.frames);
+    send_stream_summary("Stream ended");
+
+    return CborNoError;
+}
+
+static CborError handle_fill_rect_method(CborValue *map_value)
+{
+    static const char *const names[5] = {"x", "y", "width", "height", "color"};
+    uint32_t fields[5];
+
+    LOG_DEBUG("USART6 Handling fill_rect method\r\n");
+
+    CborError err = read_uint32_params(map_value, names, fields, 5);
+
+    if (err != CborNoError || fields[2] == 0 || fields[3] == 0 || fields[0] >= IMAGE_WIDTH ||
+        fields[1] >= IMAGE_HEIGHT || fields[2] > IMAGE_WIDTH - fields[0] || fields[3] > IMAGE_HEIGHT - fields[1] ||
+        fields[4] > 0xFFFF) {
+        LOG_DEBUG("USART6 Invalid fill_rect params\r\n");
+        send_cbor_response("error", "Invalid rectangle");
+        return err != CborNoError ? err : CborErrorDataTooLarge;
+    }
 
-    // Route to appropriate method handler
-    if (strcmp(method_name, "display_image") == 0) {
-        return handle_display_image_method(&map_value);
+    // The fill runs on DMA2D while the main loop goes back to the UART
+    fill_image_rect(fields[0], fields[1], fields[2], fields[3], fields[4]);
+    update_display();
+
+    send_cbor_response("success", "Rectangle filled successfully");
+
+    return CborNoError;
+}
+
+static uint8_t *begin_display_image_stream(CborValue *map_value, uint32_t length)
+{
+    (void) map_value; // Suppress unused parameter warning
+    if (length > IMAGE_DATA_SIZE) {
+        LOG_DEBUG("USART6 Image data too large (%lu bytes)\r\n", length);
+        send_cbor_response("error", "Image data too large");
+        return NULL;
     }
-    else if (strcmp(method_name, "clear_display") == 0) {
-        return handle_clear_display_method(&map_value);
+
+    LOG_DEBUG("USART6 Streaming image data (%lu bytes) into framebuffer\r\n", length);
+    return get_image_buffer(length);
+}
+
+static void complete_display_image_stream(uint32_t length)
+{
+    (void) length; // Suppress unused parameter warning
+    update_display();
+    send_cbor_response("success", "Image displayed successfully");
+}
+
+// Whole stream frames are written straight into the back buffer
+static uint32_t stream_frame_seq;
+
+static uint8_t *begin_stream_frame_stream(CborValue *map_value, uint32_t length)
+{
+    static const char *const names[1] = {"seq"};
+
+    if (!stream_session.active || length != IMAGE_DATA_SIZE ||
+        read_uint32_params(map_value, names, &stream_frame_seq, 1) != CborNoError) {
+        send_cbor_response("error", "Invalid stream frame");
+        return NULL;
     }
-    else if (strcmp(method_name, "display_default") == 0) {
-        return handle_display_default_method(&map_value);
+
+    return get_image_buffer(IMAGE_DATA_SIZE);
+}
+
+static void complete_stream_frame_stream(uint32_t length)
+{
+    (void) length; // Suppress unused parameter warning
+    stream_present(stream_frame_seq, true);
+}
+
+static image_format_t indexed_format;
+
+static uint8_t *begin_display_indexed_stream(CborValue *map_value, uint32_t length)
+{
+    CborValue params_map;
+    CborValue palette_value;
+    const uint8_t *palette;
+    size_t palette_size;
+
+    // The pixel count is fixed, so the payload size tells L8 from L4
+    if (length == IMAGE_PIXEL_COUNT) {
+        indexed_format = IMAGE_FORMAT_L8;
     }
-    else if (strcmp(method_name, "test") == 0) {
-        return handle_test_method(&map_value);
+    else if (length == IMAGE_PIXEL_COUNT / 2) {
+        indexed_format = IMAGE_FORMAT_L4;
     }
     else {
-        printf("USART6 DEBUG: Unknown method: %s\r\n", method_name);
-        send_cbor_response("error", "Unknown method");
-        return CborErrorUnknownType;
+        LOG_DEBUG("USART6 Indexed pixels must be a full L8 or L4 frame, got %lu bytes\r\n", length);
+        send_cbor_response("error", "Invalid indexed image size");
+        return NULL;
+    }
+
+    // The palette holds RGB888 entries, at most 16 for L4
+    size_t max_entries = indexed_format == IMAGE_FORMAT_L4 ? 16 : IMAGE_PALETTE_MAX_ENTRIES;
+    if (enter_params_map(map_value, &params_map) != CborNoError ||
+        find_param(&params_map, "palette", &palette_value) != CborNoError ||
+        get_byte_string(&palette_value, &palette, &palette_size) != CborNoError || palette_size == 0 ||
+        palette_size % 3 != 0 || palette_size / 3 > max_entries) {
+        LOG_DEBUG("USART6 Missing or invalid palette\r\n");
+        send_cbor_response("error", "Invalid palette");
+        return NULL;
     }
+
+    set_image_palette(palette, palette_size / 3);
+
+    LOG_DEBUG("USART6 Streaming %s pixels (%lu bytes), %zu palette entries\r\n",
+              indexed_format == IMAGE_FORMAT_L8 ? "L8" : "L4", length, palette_size / 3);
+    return get_index_buffer();
 }
 
-// Public functions ----------------------------------------------------------------------------------------------------
+static void complete_display_indexed_stream(uint32_t length)
+{
+    (void) length; // Suppress unused parameter warning
+    display_indexed(indexed_format);
+    send_cbor_response("success", "Image displayed successfully");
+}
+
+static uint32_t store_slot;
+
+static uint8_t *begin_store_image_stream(CborValue *map_value, uint32_t length)
+{
+    static const char *const names[1] = {"slot"};
+
+    if (read_uint32_params(map_value, names, &store_slot, 1) != CborNoError || store_slot >= IMAGE_SLOT_COUNT) {
+        LOG_DEBUG("USART6 Missing or invalid slot\r\n");
+        send_cbor_response("error", "Invalid slot");
+        return NULL;
+    }
+
+    if (length != IMAGE_DATA_SIZE) {
+        LOG_DEBUG("USART6 Slot images must be a full RGB565 frame, got %lu bytes\r\n", length);
+        send_cbor_response("error", "Invalid image data size");
+        return NULL;
+    }
+
+    uint8_t *buffer = get_slot_buffer(store_slot);
+    if (buffer == NULL) {
+        LOG_DEBUG("USART6 Slot %lu is on screen\r\n", store_slot);
+        send_cbor_response("error", "Slot is on screen");
+        return NULL;
+    }
+
+    LOG_DEBUG("USART6 Streaming image data (%lu bytes) into slot %lu\r\n", length, store_slot);
+    return buffer;
+}
+
+static void complete_store_image_stream(uint32_t length)
+{
+    (void) length; // Suppress unused parameter warning
+    set_slot_stored(store_slot);
+    send_cbor_response("success", "Image stored successfully");
+}
+
+static uint8_t *begin_overlay_upload_stream(CborValue *map_value, uint32_t length)
+{
+    static const char *const names[4] = {"x", "y", "width", "height"};
+    static const char *const formats[2] = {"rgb565", "argb8888"};
+    uint32_t fields[4];
+    uint32_t format = OVERLAY_FORMAT_RGB565;
+
+    // The format is optional and defaults to RGB565
+    if (read_uint32_params(map_value, names, fields, 4) != CborNoError || fields[0] >= IMAGE_WIDTH ||
+        fields[1] >= IMAGE_HEIGHT || fields[2] > IMAGE_WIDTH || fields[3] > IMAGE_HEIGHT) {
+        LOG_DEBUG("USART6 Invalid overlay_upload params\r\n");
+        send_cbor_response("error", "Invalid overlay rectangle");
+        return NULL;
+    }
+
+    if (read_choice_param(map_value, "format", formats, 2, &format) != CborNoError) {
+        send_cbor_response("error", "Invalid overlay format");
+        return NULL;
+    }
+
+    if (length != overlay_image_size(fields[2], fields[3], format)) {
+        LOG_DEBUG("USART6 Overlay pixels are %lu bytes, expected %zu\r\n", length,
+                  overlay_image_size(fields[2], fields[3], format));
+        send_cbor_response("error", "Invalid overlay pixels size");
+        return NULL;
+    }
+
+    uint8_t *buffer = overlay_begin_upload(fields[0], fields[1], fields[2], fields[3], format);
+    if (buffer == NULL) {
+        send_cbor_response("error", "Overlay does not fit");
+        return NULL;
+    }
+
+    return buffer;
+}
+
+static void complete_overlay_upload_stream(uint32_t length)
+{
+    (void) length; // Suppress unused parameter warning
+    overlay_commit_upload();
+    send_cbor_response("success", "Overlay uploaded successfully");
+}
+
+static uint8_t *begin_asset_upload_stream(CborValue *map_value, uint32_t length)
+{
+    static const char *const names[3] = {"id", "width", "height"};
+    static const char *const format_names[5] = {"rgb565", "argb8888", "argb4444", "a8", "a4"};
+    static const gfx_format_t formats[5] = {GFX_FORMAT_RGB565, GFX_FORMAT_ARGB8888, GFX_FORMAT_ARGB4444, GFX_FORMAT_A8,
+                                            GFX_FORMAT_A4};
+    uint32_t fields[3];
+    uint32_t format = 0;
+
+    // The format is optional and defaults to RGB565
+    if (read_uint32_params(map_value, names, fields, 3) != CborNoError || fields[0] >= ASSET_MAX_COUNT ||
+        fields[1] == 0 || fields[1] > IMAGE_WIDTH || fields[2] == 0 || fields[2] > IMAGE_HEIGHT ||
+        read_choice_param(map_value, "format", format_names, 5, &format) != CborNoError) {
+        LOG_DEBUG("USART6 Invalid asset_upload params\r\n");
+        send_cbor_response("error", "Invalid asset");
+        return NULL;
+    }
+
+    if (length != asset_data_size(fields[1], fields[2], formats[format])) {
+        LOG_DEBUG("USART6 Asset pixels are %lu bytes, expected %zu\r\n", length,
+                  asset_data_size(fields[1], fields[2], formats[format]));
+        send_cbor_response("error", "Invalid asset pixels size");
+        return NULL;
+    }
+
+    uint8_t *buffer = asset_begin_upload(fields[0], fields[1], fields[2], formats[format]);
+    if (buffer == NULL) {
+        send_cbor_response("error", "Asset cache full");
+        return NULL;
+    }
+
+    return buffer;
+}
+
+static void complete_asset_upload_stream(uint32_t length)
+{
+    (void) length; // Suppress unused parameter warning
+    asset_commit_upload();
+    send_cbor_response("success", "Asset uploaded successfully");
+}
+
+// Drawing or showing a frame swaps the buffers, so a chunked upload still open would be split across both. The upload
+// ends instead and its next chunk or commit is answered with an error.
+static void end_image_upload(const char *method)
+{
+    if (image_upload_active) {
+        LOG_DEBUG("USART6 %s ends the image upload in progress\r\n", method);
+        image_upload_active = false;
+    }
+}
+
+static const stream_handler_t stream_handlers[] = {
+    {"display_image", "image_data", begin_display_image_stream, complete_display_image_stream, true},
+    {"display_indexed", "pixels", begin_display_indexed_stream, complete_display_indexed_stream, true},
+    {"store_image", "image_data", begin_store_image_stream, complete_store_image_stream, false},
+    {"overlay_upload", "pixels", begin_overlay_upload_stream, complete_overlay_upload_stream, false},
+    {"asset_upload", "pixels", begin_asset_upload_stream, complete_asset_upload_stream, false},
+    {"stream_frame", "image_data", begin_stream_frame_stream, complete_stream_frame_stream, true},
+};
+
+#define STREAM_HANDLER_COUNT (sizeof(stream_handlers) / sizeof(stream_handlers[0]))
+
+static uint32_t stream_handler_calls[STREAM_HANDLER_COUNT];
+
+static const stream_handler_t *find_stream_handler(const char *method, const char *param)
+{
+    for (size_t i = 0; i < STREAM_HANDLER_COUNT; i++) {
+        if (strcmp(stream_handlers[i].method, method) == 0 && strcmp(stream_handlers[i].param, param) == 0) {
+            return &stream_handlers[i];
+        }
+    }
+
+    return NULL;
+}
+
+// Parses the buffered part of a message that ends with a streamed payload and asks its handler for a destination
+static uint8_t *begin_stream(const stream_handler_t *handler, size_t prefix_length, uint32_t payload_length)
+{
+    CborParser parser;
+    CborValue value;
+    CborValue map_value;
+
+    if (cbor_parser_init(cbor_buffer, prefix_length, 0, &parser, &value) != CborNoError ||
+        cbor_value_enter_container(&value, &map_value) != CborNoError) {
+        LOG_DEBUG("USART6 Failed to parse the header of a streamed message\r\n");
+        comm_stats.parse_errors++;
+        send_cbor_response("error", "Failed to parse message structure");
+        return NULL;
+    }
+
+    stream_handler_calls[handler - stream_handlers]++;
+    if (handler->draws) {
+        end_image_upload(handler->method);
+    }
+    return handler->begin(&map_value, payload_length);
+}
+
+// get_stats reports on the table it is listed in
+static CborError handle_get_stats_method(CborValue *map_value);
+
+// Buffered methods, in the order get_stats reports their call counts
+static const rpc_method_t rpc_methods[] = {
+    {"display_image", handle_display_image_method, true},
+    {"clear_display", handle_clear_display_method, true},
+    {"display_default", handle_display_default_method, true},
+    {"test", handle_test_method, false},
+    {"fill_rect", handle_fill_rect_method, true},
+    {"display_region", handle_display_region_method, true},
+    {"image_begin", handle_image_begin_method, false},
+    {"image_chunk", handle_image_chunk_method, false},
+    {"image_commit", handle_image_commit_method, false},
+    {"show_slot", handle_show_slot_method, true},
+    {"overlay_move", handle_overlay_move_method, false},
+    {"overlay_alpha", handle_overlay_alpha_method, false},
+    {"overlay_color_key", handle_overlay_color_key_method, false},
+    {"draw_asset", handle_draw_asset_method, true},
+    {"draw_text", handle_draw_text_method, true},
+    {"asset_clear", handle_asset_clear_method, false},
+    {"render", handle_render_method, true},
+    {"plot_create", handle_plot_create_method, true},
+    {"plot_append", handle_plot_append_method, true},
+    {"stream_begin", handle_stream_begin_method, false},
+    {"stream_frame", handle_stream_frame_method, true},
+    {"stream_end", handle_stream_end_method, false},
+    {"play", handle_play_method, true},
+    {"play_stop", handle_play_stop_method, false},
+    {"get_profile", handle_get_profile_method, false},
+    {"get_stats", handle_get_stats_method, false},
+};
+
+#define RPC_METHOD_COUNT (sizeof(rpc_methods) / sizeof(rpc_methods[0]))
+
+static uint32_t rpc_method_calls[RPC_METHOD_COUNT];
+
+// Routes a message to its method handler
+static CborError dispatch_rpc_method(const char *method_name, CborValue *map_value)
+{
+    PROFILE_SCOPE(PROFILE_STAGE_HANDLER);
+
+    for (size_t i = 0; i < RPC_METHOD_COUNT; i++) {
+        if (strcmp(rpc_methods[i].method, method_name) == 0) {
+            rpc_method_calls[i]++;
+            if (rpc_methods[i].draws) {
+                end_image_upload(method_name);
+            }
+            return rpc_methods[i].handle(map_value);
+        }
+    }
+
+    LOG_DEBUG("USART6 Unknown method: %s\r\n", method_name);
+    send_cbor_response("error", "Unknown method");
+    return CborErrorUnknownType;
+}
+
+// Reports the transport counters, with the log messages dropped and the receive ring's size to put its peak in scale
+static void send_stats_response(void)
+{
+    PROFILE_SCOPE(PROFILE_STAGE_RESPONSE);
+
+    CborEncoder encoder;
+    CborEncoder map_encoder;
+    uint8_t *response_buffer = begin_response(&encoder, &map_encoder, "success", "Stats read", 15);
+
+    cbor_encode_text_string(&map_encoder, "rx_bytes", 8);
+    cbor_encode_uint(&map_encoder, comm_stats.rx_bytes);
+    cbor_encode_text_string(&map_encoder, "rx_frames", 9);
+    cbor_encode_uint(&map_encoder, comm_stats.rx_frames);
+    cbor_encode_text_string(&map_encoder, "tx_bytes", 8);
+    cbor_encode_uint(&map_encoder, comm_stats.tx_bytes);
+    cbor_encode_text_string(&map_encoder, "tx_frames", 9);
+    cbor_encode_uint(&map_encoder, comm_stats.tx_frames);
+    cbor_encode_text_string(&map_encoder, "overrun_errors", 14);
+    cbor_encode_uint(&map_encoder, comm_stats.overrun_errors);
+    cbor_encode_text_string(&map_encoder, "framing_errors", 14);
+    cbor_encode_uint(&map_encoder, comm_stats.framing_errors);
+    cbor_encode_text_string(&map_encoder, "noise_errors", 12);
+    cbor_encode_uint(&map_encoder, comm_stats.noise_errors);
+    cbor_encode_text_string(&map_encoder, "resyncs", 7);
+    cbor_encode_uint(&map_encoder, comm_stats.resyncs);
+    cbor_encode_text_string(&map_encoder, "parse_errors", 12);
+    cbor_encode_uint(&map_encoder, comm_stats.parse_errors);
+    cbor_encode_text_string(&map_encoder, "oversize_messages", 17);
+    cbor_encode_uint(&map_encoder, comm_stats.oversize_messages);
+    cbor_encode_text_string(&map_encoder, "ring_overflows", 14);
+    cbor_encode_uint(&map_encoder, comm_stats.ring_overflows);
+    cbor_encode_text_string(&map_encoder, "ring_peak", 9);
+    cbor_encode_uint(&map_encoder, comm_stats.ring_peak);
+    cbor_encode_text_string(&map_encoder, "ring_size", 9);
+    cbor_encode_uint(&map_encoder, USART6_RX_BUFFER_SIZE);
+    cbor_encode_text_string(&map_encoder, "log_dropped", 11);
+    cbor_encode_uint(&map_encoder, log_dropped());
+    cbor_encode_text_string(&map_encoder, "methods", 7);
+    cbor_encode_uint(&map_encoder, RPC_METHOD_COUNT + STREAM_HANDLER_COUNT);
+
+    end_response(&encoder, &map_encoder, response_buffer);
+}
+
+// Method call counts are reported a page at a time from one list of the buffered methods followed by the streamed
+// ones, so the host can read them all whatever their number. A streamed method shares its buffered twin's name but is
+// counted apart.
+static void send_method_stats_response(uint32_t first)
+{
+    PROFILE_SCOPE(PROFILE_STAGE_RESPONSE);
+
+    uint32_t total = RPC_METHOD_COUNT + STREAM_HANDLER_COUNT;
+    if (first > total) {
+        first = total;
+    }
+    uint32_t next = total - first > STATS_METHODS_PER_PAGE ? first + STATS_METHODS_PER_PAGE : total;
+
+    CborEncoder encoder;
+    CborEncoder map_encoder;
+    CborEncoder calls_encoder;
+    uint8_t *response_buffer = begin_response(&encoder, &map_encoder, "success", "Method counts read", 3);
+
+    cbor_encode_text_string(&map_encoder, "methods", 7);
+    cbor_encode_uint(&map_encoder, total);
+    cbor_encode_text_string(&map_encoder, "next", 4);
+    cbor_encode_uint(&map_encoder, next);
+
+    // [method, streamed, calls] for each method on the page
+    cbor_encode_text_string(&map_encoder, "calls", 5);
+    cbor_encoder_create_array(&map_encoder, &calls_encoder, next - first);
+    for (uint32_t i = first; i < next; i++) {
+        bool streamed = i >= RPC_METHOD_COUNT;
+        const char *method = streamed ? stream_handlers[i - RPC_METHOD_COUNT].method : rpc_methods[i].method;
+        CborEncoder entry_encoder;
+
+        cbor_encoder_create_array(&calls_encoder, &entry_encoder, 3);
+        cbor_encode_text_string(&entry_encoder, method, strlen(method));
+        cbor_encode_boolean(&entry_encoder, streamed);
+        cbor_encode_uint(&entry_encoder, streamed ? stream_handler_calls[i - RPC_METHOD_COUNT] : rpc_method_calls[i]);
+        cbor_encoder_close_container(&calls_encoder, &entry_encoder);
+    }
+    cbor_encoder_close_container(&map_encoder, &calls_encoder);
 
-// Redirect printf to UART1
-int _write(int file, char *ptr, int len)
+    end_response(&encoder, &map_encoder, response_buffer);
+}
+
+// Without params the transport counters, with "first" a page of method call counts starting there
+static CborError handle_get_stats_method(CborValue *map_value)
+{
+    uint32_t first = UINT32_MAX;
+
+    LOG_DEBUG("USART6 Handling get_stats method\r\n");
+
+    if (read_optional_uint32(map_value, "first", &first) != CborNoError) {
+        send_cbor_response("error", "Invalid get_stats params");
+        return CborErrorIllegalType;
+    }
+
+    if (first != UINT32_MAX) {
+        send_method_stats_response(first);
+        return CborNoError;
+    }
+
+    send_stats_response();
+
+    return CborNoError;
+}
+
+static CborError process_cbor_rpc_message(const uint8_t *cbor_data, size_t data_length, const char *method_name)
 {
-    (void) file; // Suppress unused parameter warning
-    HAL_UART_Transmit(&huart1, (uint8_t *) ptr, len, HAL_MAX_DELAY);
-    return len;
+    PROFILE_SCOPE(PROFILE_STAGE_RPC);
+
+    LOG_DEBUG("USART6 Starting CBOR RPC message processing, length: %zu\r\n", data_length);
+
+    // The push-parser has already located the method while the message was arriving
+    if (method_name == NULL) {
+        LOG_DEBUG("USART6 Method field not found\r\n");
+        send_cbor_response("error", "Method field not found in RPC message");
+        return CborErrorUnknownType;
+    }
+
+    LOG_DEBUG("USART6 Dispatching method: %s\r\n", method_name);
+
+    // Parse the CBOR message
+    CborParser parser;
+    CborValue value;
+
+    CborError err = cbor_parser_init(cbor_data, data_length, 0, &parser, &value);
+    if (err != CborNoError) {
+        LOG_ERROR("USART6 Error parsing CBOR: %d\r\n", err);
+        comm_stats.parse_errors++;
+        LOG_DEBUG("USART6 CBOR parser init failed\r\n");
+        send_cbor_response("error", "Failed to parse CBOR message");
+        return err;
+    }
+
+    // Enter the root map for the method handlers
+    CborValue map_value;
+    err = cbor_value_enter_container(&value, &map_value);
+    if (err != CborNoError) {
+        LOG_ERROR("USART6 Error entering map: %d\r\n", err);
+        comm_stats.parse_errors++;
+        LOG_DEBUG("USART6 Failed to enter map container\r\n");
+        send_cbor_response("error", "Failed to parse message structure");
+        return err;
+    }
+
+    return dispatch_rpc_method(method_name, &map_value);
 }
 
-void USART6_Start_Receive_IT(void)
+// Public functions ----------------------------------------------------------------------------------------------------
+
+void USART6_Start_Receive_DMA(void)
 {
-    HAL_UART_Receive_IT(&huart6, &usart6_rx_buffer[usart6_rx_head], 1);
+    // Circular DMA into the ring buffer - half transfer, transfer complete and IDLE line events advance the head
+    HAL_UARTEx_ReceiveToIdle_DMA(&huart6, usart6_rx_buffer, USART6_RX_BUFFER_SIZE);
 }
 
 uint32_t USART6_Available(void)
@@ -614,135 +2191,321 @@ uint8_t USART6_Read_Byte(void)
 
     uint8_t data = usart6_rx_buffer[usart6_rx_tail];
     usart6_rx_tail = (usart6_rx_tail + 1) % USART6_RX_BUFFER_SIZE;
+    comm_stats.rx_bytes++;
     return data;
 }
 
+uint32_t USART6_Read(uint8_t *dest, uint32_t max_length)
+{
+    uint32_t length = USART6_Available();
+    if (length > max_length) {
+        length = max_length;
+    }
+
+    // Copy in at most two runs, splitting where the ring wraps
+    uint32_t first = USART6_RX_BUFFER_SIZE - usart6_rx_tail;
+    if (first > length) {
+        first = length;
+    }
+
+    memcpy(dest, &usart6_rx_buffer[usart6_rx_tail], first);
+    memcpy(dest + first, usart6_rx_buffer, length - first);
+
+    usart6_rx_tail = (usart6_rx_tail + length) % USART6_RX_BUFFER_SIZE;
+    comm_stats.rx_bytes += length;
+    return length;
+}
+
 void USART6_Send_String(const char *str)
 {
-    HAL_UART_Transmit(&huart6, (uint8_t *) str, strlen(str), HAL_MAX_DELAY);
+    // Raw strings share the response queue so they never collide with an in-flight DMA transfer
+    size_t length = strlen(str);
+    if (length > USART6_TX_BUFFER_SIZE) {
+        length = USART6_TX_BUFFER_SIZE;
+    }
+
+    uint8_t *slot = usart6_tx_acquire();
+    memcpy(slot, str, length);
+    usart6_tx_length[usart6_tx_head] = (uint16_t) length;
+    usart6_tx_head = (usart6_tx_head + 1) % USART6_TX_QUEUE_LENGTH;
+
+    usart6_tx_kick();
 }
 
 void USART6_Process_Message(void)
 {
-    static uint32_t expected_length = 0;
-    static uint32_t bytes_received = 0;
-    static uint8_t state = 0; // 0 = reading length, 1 = reading data
+    static rpc_parser_t parser __attribute__((section(".dtcm")));
+    static message_state_t state = MESSAGE_STATE_RECEIVE;
+    static const stream_handler_t *stream = NULL;
+    static uint8_t *stream_buffer;
+    static uint32_t stream_offset = 0;
+
+    if (!usart6_rx_error && !usart6_rx_overflow && USART6_Available() == 0) {
+        // A message the host stopped sending partway is dropped once the line has gone quiet, otherwise the start of
+        // the next request would be taken for the rest of it. Bytes the DMA has written since the last reception
+        // event mean the line is still busy.
+        bool started = state != MESSAGE_STATE_RECEIVE || parser.state != RPC_PARSER_STATE_PREFIX ||
+                       parser.prefix_bytes != 0;
+        if (started && HAL_GetTick() - usart6_rx_tick >= USART6_RESYNC_IDLE_MS &&
+            usart6_rx_dma_head() == usart6_rx_head) {
+            LOG_ERROR("USART6 Error: Line idle mid-message, dropping %lu of %lu bytes\r\n", parser.offset,
+                      parser.message_length);
+            comm_stats.resyncs++;
+            RESET_MESSAGE_STATE();
+        }
+        return;
+    }
 
-    while (USART6_Available() > 0) {
-        uint8_t received_byte = USART6_Read_Byte();
+    PROFILE_SCOPE(PROFILE_STAGE_MESSAGE);
+
+    if (usart6_rx_error) {
+        // Any UART error aborts a DMA reception, so drop the partial message and restart from an empty ring
+        LOG_ERROR("USART6 Error: Reception aborted, restarting DMA\r\n");
+        comm_stats.resyncs++;
+        usart6_rx_error = false;
+        usart6_rx_head = 0;
+        usart6_rx_tail = 0;
+        RESET_MESSAGE_STATE();
+        USART6_Start_Receive_DMA();
+    }
 
-        if (state != 0) {
-            // Reading CBOR data
-            if (bytes_received < CBOR_BUFFER_SIZE) {
-                cbor_buffer[bytes_received++] = received_byte;
-            }
-            else {
-                printf("USART6 Error: Buffer overflow\r\n");
-                printf("USART6 DEBUG: Buffer overflow - bytes_received: %lu, buffer size: %d\r\n", bytes_received,
-                       CBOR_BUFFER_SIZE);
-
-                // Flush receive buffer to get back in sync with host
-                printf("USART6 DEBUG: Flushing receive buffer to resync\r\n");
-                while (USART6_Available() > 0) {
-                    USART6_Read_Byte();
-                }
+    if (usart6_rx_overflow) {
+        // The DMA lapped the tail, so the ring no longer follows on from what was read
+        LOG_ERROR("USART6 Error: Receive ring overflowed, flushing to resync\r\n");
+        comm_stats.resyncs++;
+        usart6_rx_overflow = false;
+        usart6_rx_flush();
+        RESET_MESSAGE_STATE();
+    }
 
-                RESET_MESSAGE_STATE();
-                continue;
-            }
+    uint32_t available;
+    while ((available = USART6_Available()) > 0) {
+        if (available > comm_stats.ring_peak) {
+            comm_stats.ring_peak = available;
+        }
 
-            if (bytes_received != expected_length) {
+        if (state == MESSAGE_STATE_STREAM) {
+            // Copy payload bytes straight from the ring buffer to their final offset
+            uint32_t copied = USART6_Read(stream_buffer + stream_offset, rpc_parser_string_remaining(&parser));
+            stream_offset += copied;
+
+            if (rpc_parser_skip(&parser, copied) != RPC_PARSER_COMPLETE) {
                 continue;
             }
 
-            // We have the complete CBOR message, process it
-            printf("USART6 Received complete CBOR message (%lu bytes)\r\n", expected_length);
-            printf("USART6 DEBUG: Message complete, starting CBOR processing\r\n");
-
-            // Parse the CBOR message
-            CborError err = process_cbor_rpc_message(cbor_buffer, expected_length);
-            if (err != CborNoError) {
-                printf("USART6 Error processing CBOR message: %d\r\n", err);
-                printf("USART6 DEBUG: CBOR processing failed with error %d\r\n", err);
-            }
-            else {
-                printf("USART6 DEBUG: CBOR processing completed successfully\r\n");
-            }
+            LOG_DEBUG("USART6 Streamed %s payload of %s (%lu bytes)\r\n", stream->param, stream->method, stream_offset);
+            stream->complete(stream_offset);
 
-            // Reset for next message
             RESET_MESSAGE_STATE();
             continue;
         }
 
-        // Reading 4-byte length prefix (big-endian)
-        cbor_buffer[bytes_received++] = received_byte;
+        if (state == MESSAGE_STATE_DISCARD) {
+            // cbor_buffer is free while a rejected message drains, so use it as scratch space
+            uint32_t remaining = rpc_parser_remaining(&parser);
+            uint32_t dropped = USART6_Read(cbor_buffer, remaining < CBOR_BUFFER_SIZE ? remaining : CBOR_BUFFER_SIZE);
 
-        if (bytes_received != 4) {
+            if (rpc_parser_skip(&parser, dropped) == RPC_PARSER_COMPLETE) {
+                LOG_DEBUG("USART6 Discarded rejected message (%lu bytes)\r\n", parser.message_length);
+                RESET_MESSAGE_STATE();
+            }
             continue;
         }
 
-        // We have the complete length
-        expected_length = ((uint32_t) cbor_buffer[0] << 24) | ((uint32_t) cbor_buffer[1] << 16) |
-                          ((uint32_t) cbor_buffer[2] << 8) | cbor_buffer[3];
-
-        printf("USART6 Expecting CBOR message of %lu bytes\r\n", expected_length);
-        printf("USART6 DEBUG: Length prefix received: %02X %02X %02X %02X\r\n", cbor_buffer[0], cbor_buffer[1],
-               cbor_buffer[2], cbor_buffer[3]);
+        uint8_t received_byte = USART6_Read_Byte();
 
-        // Print more bytes from buffer to see what's actually there
-        printf("USART6 DEBUG: Next 16 bytes in buffer:");
-        for (int i = 0; i < 16 && USART6_Available() > 0; i++) {
-            printf(" %02X", usart6_rx_buffer[(usart6_rx_tail + i) % USART6_RX_BUFFER_SIZE]);
+        // Keep a copy of the CBOR body for the method handlers
+        bool in_body = parser.state != RPC_PARSER_STATE_PREFIX;
+        if (in_body && parser.offset < CBOR_BUFFER_SIZE) {
+            cbor_buffer[parser.offset] = received_byte;
         }
-        printf("\r\n");
 
-        // Sanity check on message length (increased for image data)
-        if (expected_length > CBOR_BUFFER_SIZE) {
-            printf("USART6 Error: Message too large (%lu bytes)\r\n", expected_length);
-            printf("USART6 DEBUG: Message too large - expected: %lu, buffer size: %d\r\n", expected_length,
-                   CBOR_BUFFER_SIZE);
-            send_cbor_response("error", "Message too large");
+        switch (rpc_parser_push(&parser, received_byte)) {
+        case RPC_PARSER_LENGTH:
+            LOG_DEBUG("USART6 Expecting CBOR message of %lu bytes\r\n", parser.message_length);
+            comm_stats.rx_frames++;
+
+            // Sanity check on message length (only a streamed image may exceed the CBOR buffer)
+            if (parser.message_length > IMAGE_MESSAGE_MAX_SIZE) {
+                LOG_ERROR("USART6 Error: Message too large (%lu bytes)\r\n", parser.message_length);
+                LOG_DEBUG("USART6 Message too large - expected: %lu, maximum: %d\r\n", parser.message_length,
+                          IMAGE_MESSAGE_MAX_SIZE);
+                comm_stats.oversize_messages++;
+                send_cbor_response("error", "Message too large");
+
+                if (parser.message_length <= MESSAGE_DISCARD_MAX_SIZE) {
+                    // Drop exactly the announced body so the next length prefix is read where it starts
+                    rpc_parser_discard(&parser);
+                    state = MESSAGE_STATE_DISCARD;
+                    continue;
+                }
+
+                // A prefix this large is corrupt or out of step, flush receive buffer to get back in sync with host
+                LOG_DEBUG("USART6 Flushing receive buffer to resync\r\n");
+                comm_stats.resyncs++;
+                usart6_rx_flush();
+                RESET_MESSAGE_STATE();
+                continue;
+            }
 
-            // Flush receive buffer to get back in sync with host
-            printf("USART6 DEBUG: Flushing receive buffer to resync\r\n");
-            while (USART6_Available() > 0) {
-                USART6_Read_Byte();
+            if (parser.message_length == 0) {
+                break;
             }
 
-            RESET_MESSAGE_STATE();
+            LOG_DEBUG("USART6 Length validation passed, switching to data reception mode\r\n");
             continue;
+
+        case RPC_PARSER_PARAM_BYTES:
+            // A byte string that ends the message goes straight to its destination as it arrives
+            if (parser.has_method && parser.param_offset <= CBOR_BUFFER_SIZE &&
+                parser.param_offset + parser.param_length == parser.message_length) {
+                stream = find_stream_handler(parser.method, parser.param_name);
+            }
+
+            if (stream != NULL) {
+                // Stand an empty byte string in for the payload so the buffered prefix parses as a complete message
+                cbor_buffer[parser.param_header_offset] = 0x40;
+                stream_buffer = begin_stream(stream, parser.param_header_offset + 1, parser.param_length);
+
+                if (stream_buffer == NULL) {
+                    rpc_parser_discard(&parser);
+                    state = MESSAGE_STATE_DISCARD;
+                }
+                else {
+                    stream_offset = 0;
+                    state = MESSAGE_STATE_STREAM;
+                }
+                continue;
+            }
+            // Fall through
+
+        default:
+            // Messages too large to buffer are only accepted when their payload streams
+            if (parser.offset >= CBOR_BUFFER_SIZE) {
+                LOG_ERROR("USART6 Error: Message too large (%lu bytes)\r\n", parser.message_length);
+                comm_stats.oversize_messages++;
+                send_cbor_response("error", "Message too large");
+                rpc_parser_discard(&parser);
+                state = MESSAGE_STATE_DISCARD;
+            }
+            continue;
+
+        case RPC_PARSER_COMPLETE:
+            break;
+        }
+
+        // We have the complete CBOR message, process it
+        LOG_DEBUG("USART6 Received complete CBOR message (%lu bytes)\r\n", parser.message_length);
+
+        CborError err;
+        if (parser.cbor_error) {
+            LOG_DEBUG("USART6 Push-parser rejected the CBOR message\r\n");
+            comm_stats.parse_errors++;
+            send_cbor_response("error", "Failed to parse CBOR message");
+            err = CborErrorIllegalType;
+        }
+        else {
+            err = process_cbor_rpc_message(cbor_buffer, parser.message_length,
+                                           parser.has_method ? parser.method : NULL);
+        }
+
+        if (err != CborNoError) {
+            LOG_ERROR("USART6 Error processing CBOR message: %d\r\n", err);
+            LOG_DEBUG("USART6 CBOR processing failed with error %d\r\n", err);
+        }
+        else {
+            LOG_DEBUG("USART6 CBOR processing completed successfully\r\n");
         }
 
-        printf("USART6 DEBUG: Length validation passed, switching to data reception mode\r\n");
-        bytes_received = 0;
-        state = 1;
+        // Reset for next message
+        RESET_MESSAGE_STATE();
     }
 }
 
 void CommInit(void)
 {
-    printf("USART6 DEBUG: Initializing communication\r\n");
-
-    // Initialize SDRAM buffers to zero (since they're in NOLOAD section)
-    memset(usart6_rx_buffer, 0, sizeof(usart6_rx_buffer));
-    memset(cbor_buffer, 0, sizeof(cbor_buffer));
+    LOG_DEBUG("USART6 Initializing communication\r\n");
 
     // Reset buffer pointers
     usart6_rx_head = 0;
     usart6_rx_tail = 0;
+    usart6_tx_head = 0;
+    usart6_tx_tail = 0;
+    usart6_tx_busy = false;
+
+    // Initialize the SDRAM buffer to zero (since it's in a NOLOAD section) with a DMA2D fill that leaves the CPU free
+    gfx_fill_bytes(cbor_buffer, sizeof(cbor_buffer), 0, NULL, NULL);
+
+    // The ring buffer starts out zeroed in DTCM
+    USART6_Start_Receive_DMA();
+
+    LOG_DEBUG("USART6 Communication initialization complete\r\n");
+}
+
+// UART reception event callback - DMA half transfer, transfer complete or IDLE line
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+    if (huart->Instance == USART6) {
+        // Size is the DMA write position in the ring buffer (equal to the buffer size on transfer complete). A full
+        // ring reads as empty, so an advance past the free space has to be caught here, the main loop resyncs.
+        uint32_t head = Size % USART6_RX_BUFFER_SIZE;
+        uint32_t advance = (USART6_RX_BUFFER_SIZE + head - usart6_rx_head) % USART6_RX_BUFFER_SIZE;
+        if (advance > USART6_RX_BUFFER_SIZE - 1 - USART6_Available()) {
+            comm_stats.ring_overflows++;
+            usart6_rx_overflow = true;
+        }
 
-    USART6_Start_Receive_IT();
-    printf("USART6 DEBUG: Communication initialization complete\r\n");
+        usart6_rx_head = head;
+        usart6_rx_tick = HAL_GetTick();
+    }
 }
 
-// UART callback function
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+// UART transmit complete callback - release the slot and start the next queued response
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
 {
     if (huart->Instance == USART6) {
-        // Move to next position in circular buffer
-        usart6_rx_head = (usart6_rx_head + 1) % USART6_RX_BUFFER_SIZE;
+        comm_stats.tx_bytes += usart6_tx_length[usart6_tx_tail];
+        comm_stats.tx_frames++;
+        usart6_tx_tail = (usart6_tx_tail + 1) % USART6_TX_QUEUE_LENGTH;
+        usart6_tx_busy = false;
+        usart6_tx_kick();
+    }
+    else if (huart->Instance == USART1) {
+        log_tx_complete();
+    }
+}
+
+// UART error callback function
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+    if (huart->Instance == USART1 && huart->gState == HAL_UART_STATE_READY) {
+        // A failed log transfer loses its bytes rather than stalling the log
+        log_tx_complete();
+    }
+
+    if (huart->Instance != USART6) {
+        return;
+    }
+
+    if (huart->ErrorCode & HAL_UART_ERROR_ORE) {
+        comm_stats.overrun_errors++;
+    }
+    if (huart->ErrorCode & HAL_UART_ERROR_FE) {
+        comm_stats.framing_errors++;
+    }
+    if (huart->ErrorCode & HAL_UART_ERROR_NE) {
+        comm_stats.noise_errors++;
+    }
+
+    if (huart->RxState == HAL_UART_STATE_READY) {
+        // Reception is restarted from the main loop so the ring indices are never reset under its feet
+        usart6_rx_error = true;
+    }
 
-        // Continue receiving immediately - minimize time in interrupt
-        HAL_UART_Receive_IT(&huart6, &usart6_rx_buffer[usart6_rx_head], 1);
+    if (huart->gState == HAL_UART_STATE_READY && usart6_tx_busy) {
+        // A failed transmit drops its slot rather than stalling the queue
+        usart6_tx_tail = (usart6_tx_tail + 1) % USART6_TX_QUEUE_LENGTH;
+        usart6_tx_busy = false;
+        usart6_tx_kick();
     }
-}
\ No newline at end of file
+}
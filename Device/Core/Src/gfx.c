@@ -0,0 +1,464 @@
+#include "gfx.h"
+#include "cache.h"
+#include "log.h"
+#include "main.h"
+#include <string.h>
+
+// Private macros ------------------------------------------------------------------------------------------------------
+
+#define GFX_MAX_WIDTH 16383  // DMA2D NLR.PL is 14 bits
+#define GFX_MAX_HEIGHT 65535 // DMA2D NLR.NL is 16 bits
+#define GFX_FILL_ROW_PIXELS 1024
+
+_Static_assert(GFX_RGB565_TO_ARGB8888(0xF800) == 0xFFFF0000, "RGB565 red must widen to ARGB8888 red");
+_Static_assert(GFX_RGB565_TO_ARGB8888(0x07E0) == 0xFF00FF00, "RGB565 green must widen to ARGB8888 green");
+_Static_assert(GFX_RGB565_TO_ARGB8888(0x001F) == 0xFF0000FF, "RGB565 blue must widen to ARGB8888 blue");
+_Static_assert(GFX_RGB565_TO_ARGB8888(0x8410) == 0xFF848284, "RGB565 grey must widen channel by channel");
+
+// Private types -------------------------------------------------------------------------------------------------------
+
+typedef enum {
+    GFX_JOB_TRANSFER, // R2M fill, M2M copy, M2M_PFC conversion or M2M_BLEND onto the destination
+    GFX_JOB_CLUT,     // Load a CLUT into the foreground layer for the conversions that follow
+    GFX_JOB_SYNC,     // No DMA2D work, only the callback once the jobs ahead of it are done
+} gfx_job_type_t;
+
+typedef struct {
+    gfx_job_type_t type;
+    uint32_t mode;        // DMA2D_R2M, DMA2D_M2M, ...
+    uint32_t output_mode; // DMA2D_OUTPUT_*
+    uint32_t input_mode;  // DMA2D_INPUT_* of the foreground layer
+    uint32_t input_alpha; // Foreground alpha (A8/A4: alpha and colour) combined with each pixel's alpha
+    uint32_t source;      // Colour for R2M, source address otherwise
+    uint32_t dest;
+    uint16_t width;
+    uint16_t height;
+    uint16_t input_offset;  // Pixels skipped at the end of each input line
+    uint16_t output_offset; // Pixels skipped at the end of each output line
+    gfx_callback_t callback;
+    void *context;
+} gfx_job_t;
+
+// Private variables ---------------------------------------------------------------------------------------------------
+
+static gfx_job_t gfx_queue[GFX_QUEUE_LENGTH];
+static volatile uint32_t gfx_head = 0; // Next slot to fill (main loop)
+static volatile uint32_t gfx_tail = 0; // Job running on DMA2D (interrupt)
+static volatile bool gfx_running = false;
+
+// External variables --------------------------------------------------------------------------------------------------
+
+extern DMA2D_HandleTypeDef hdma2d;
+
+// Private functions ---------------------------------------------------------------------------------------------------
+
+static void gfx_transfer_complete(DMA2D_HandleTypeDef *handle);
+static void gfx_transfer_error(DMA2D_HandleTypeDef *handle);
+
+// Bits per pixel of a DMA2D input mode, the output modes share their values
+static uint32_t gfx_mode_bits(uint32_t mode)
+{
+    switch (mode) {
+    case DMA2D_INPUT_ARGB8888:
+        return 32;
+    case DMA2D_INPUT_RGB888:
+        return 24;
+    case DMA2D_INPUT_RGB565:
+    case DMA2D_INPUT_ARGB1555:
+    case DMA2D_INPUT_ARGB4444:
+    case DMA2D_INPUT_AL88:
+        return 16;
+    case DMA2D_INPUT_L4:
+    case DMA2D_INPUT_A4:
+        return 4;
+    default:
+        return 8;
+    }
+}
+
+// Bytes from the first pixel of an area to its last, with offset pixels skipped at the end of each line
+static size_t gfx_span(uint16_t width, uint16_t height, uint16_t offset, uint32_t mode)
+{
+    return (((size_t) (height - 1) * (width + offset) + width) * gfx_mode_bits(mode) + 7) / 8;
+}
+
+static size_t gfx_source_size(const gfx_job_t *job)
+{
+    return gfx_span(job->width, job->height, job->input_offset, job->input_mode);
+}
+
+static size_t gfx_dest_size(const gfx_job_t *job)
+{
+    return gfx_span(job->width, job->height, job->output_offset, job->output_mode);
+}
+
+// Completes a job without running it on DMA2D. The engine counts as running meanwhile, so jobs the callback submits
+// are only queued and the caller's loop starts them in order.
+static void gfx_skip_job(const gfx_job_t *job)
+{
+    gfx_callback_t callback = job->callback;
+    void *context = job->context;
+
+    gfx_running = true;
+    gfx_tail++;
+    if (callback != NULL) {
+        callback(context);
+    }
+}
+
+// Starts the job at the tail of the queue, called with interrupts disabled or from the DMA2D interrupt
+static void gfx_start_next(void)
+{
+    while (gfx_tail != gfx_head) {
+        gfx_job_t *job = &gfx_queue[gfx_tail % GFX_QUEUE_LENGTH];
+        HAL_StatusTypeDef status;
+
+        if (job->type == GFX_JOB_SYNC) {
+            gfx_skip_job(job);
+            continue;
+        }
+
+        hdma2d.Init.Mode = job->mode;
+        hdma2d.Init.ColorMode = job->output_mode;
+        hdma2d.Init.OutputOffset = job->output_offset;
+        hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputColorMode = job->input_mode;
+        hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputOffset = job->input_offset;
+        hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaMode =
+            job->mode == DMA2D_M2M_BLEND ? DMA2D_COMBINE_ALPHA : DMA2D_NO_MODIF_ALPHA;
+        hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputAlpha = job->input_alpha;
+        hdma2d.XferCpltCallback = gfx_transfer_complete;
+        hdma2d.XferErrorCallback = gfx_transfer_error;
+
+        status = HAL_DMA2D_Init(&hdma2d);
+        if (status == HAL_OK && job->mode != DMA2D_R2M) {
+            status = HAL_DMA2D_ConfigLayer(&hdma2d, DMA2D_FOREGROUND_LAYER);
+        }
+
+        // Blending reads the background from the destination itself
+        if (status == HAL_OK && job->mode == DMA2D_M2M_BLEND) {
+            hdma2d.LayerCfg[DMA2D_BACKGROUND_LAYER].InputColorMode = job->output_mode;
+            hdma2d.LayerCfg[DMA2D_BACKGROUND_LAYER].InputOffset = job->output_offset;
+            hdma2d.LayerCfg[DMA2D_BACKGROUND_LAYER].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+            hdma2d.LayerCfg[DMA2D_BACKGROUND_LAYER].InputAlpha = 0xFF;
+            status = HAL_DMA2D_ConfigLayer(&hdma2d, DMA2D_BACKGROUND_LAYER);
+        }
+
+        if (status == HAL_OK && job->type == GFX_JOB_CLUT) {
+            DMA2D_CLUTCfgTypeDef clut_config = {
+                .pCLUT = (uint32_t *) job->source,
+                .CLUTColorMode = DMA2D_CCM_ARGB8888,
+                .Size = job->width - 1,
+            };
+            status = HAL_DMA2D_CLUTStartLoad_IT(&hdma2d, &clut_config, DMA2D_FOREGROUND_LAYER);
+        }
+        else if (status == HAL_OK && job->mode == DMA2D_M2M_BLEND) {
+            status = HAL_DMA2D_BlendingStart_IT(&hdma2d, job->source, job->dest, job->dest, job->width, job->height);
+        }
+        else if (status == HAL_OK) {
+            status = HAL_DMA2D_Start_IT(&hdma2d, job->source, job->dest, job->width, job->height);
+        }
+
+        if (status == HAL_OK) {
+            gfx_running = true;
+            return;
+        }
+
+        // Drop a job DMA2D refused and carry on with the next one, its owner still gets the callback
+        LOG_ERROR("GFX Error: Failed to start DMA2D job (error 0x%08lX)\r\n", HAL_DMA2D_GetError(&hdma2d));
+        gfx_skip_job(job);
+    }
+
+    gfx_running = false;
+}
+
+static void gfx_finish_job(void)
+{
+    gfx_job_t *job = &gfx_queue[gfx_tail % GFX_QUEUE_LENGTH];
+    gfx_callback_t callback = job->callback;
+    void *context = job->context;
+
+    // Lines the CPU cached before the job hold what DMA2D has since overwritten
+    if (job->type == GFX_JOB_TRANSFER) {
+        cache_invalidate((const void *) job->dest, gfx_dest_size(job));
+    }
+
+    gfx_tail++;
+    gfx_start_next();
+
+    if (callback != NULL) {
+        callback(context);
+    }
+}
+
+static void gfx_transfer_complete(DMA2D_HandleTypeDef *handle)
+{
+    (void) handle; // Suppress unused parameter warning
+    gfx_finish_job();
+}
+
+static void gfx_transfer_error(DMA2D_HandleTypeDef *handle)
+{
+    LOG_ERROR("GFX Error: DMA2D transfer error (error 0x%08lX)\r\n", HAL_DMA2D_GetError(handle));
+    gfx_finish_job();
+}
+
+static uint32_t gfx_input_mode(gfx_format_t format)
+{
+    switch (format) {
+    case GFX_FORMAT_RGB565:
+        return DMA2D_INPUT_RGB565;
+    case GFX_FORMAT_L8:
+        return DMA2D_INPUT_L8;
+    case GFX_FORMAT_L4:
+        return DMA2D_INPUT_L4;
+    case GFX_FORMAT_ARGB4444:
+        return DMA2D_INPUT_ARGB4444;
+    case GFX_FORMAT_A8:
+        return DMA2D_INPUT_A8;
+    case GFX_FORMAT_A4:
+        return DMA2D_INPUT_A4;
+    default:
+        return DMA2D_INPUT_ARGB8888;
+    }
+}
+
+static bool gfx_is_output_format(gfx_format_t format)
+{
+    return format == GFX_FORMAT_ARGB8888 || format == GFX_FORMAT_RGB565;
+}
+
+static uint32_t gfx_output_mode(gfx_format_t format)
+{
+    return format == GFX_FORMAT_RGB565 ? DMA2D_OUTPUT_RGB565 : DMA2D_OUTPUT_ARGB8888;
+}
+
+static bool gfx_submit(const gfx_job_t *job)
+{
+    if (job->type != GFX_JOB_SYNC && (job->width == 0 || job->height == 0 || job->width > GFX_MAX_WIDTH)) {
+        return false;
+    }
+
+    // DMA2D reads memory rather than the cache, so the source goes out first. So do the destination's lines, which
+    // blending reads and which could otherwise be evicted over the result later.
+    if (job->type == GFX_JOB_CLUT) {
+        cache_clean((const void *) job->source, job->width * sizeof(uint32_t));
+    }
+    else if (job->type == GFX_JOB_TRANSFER) {
+        if (job->mode != DMA2D_R2M) {
+            cache_clean((const void *) job->source, gfx_source_size(job));
+        }
+        cache_clean((const void *) job->dest, gfx_dest_size(job));
+    }
+
+    // Wait for a free slot, the DMA2D interrupt keeps draining the queue
+    while (gfx_head - gfx_tail >= GFX_QUEUE_LENGTH) {
+    }
+
+    gfx_queue[gfx_head % GFX_QUEUE_LENGTH] = *job;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    gfx_head++;
+    if (!gfx_running) {
+        gfx_start_next();
+    }
+    __set_PRIMASK(primask);
+
+    return true;
+}
+
+// Public functions ----------------------------------------------------------------------------------------------------
+
+bool gfx_fill(void *dest, uint16_t width, uint16_t height, uint16_t pitch, gfx_format_t format, uint32_t color,
+              gfx_callback_t callback, void *context)
+{
+    gfx_job_t job = {
+        .type = GFX_JOB_TRANSFER,
+        .mode = DMA2D_R2M,
+        .output_mode = gfx_output_mode(format),
+        // DMA2D takes the register colour as ARGB8888 whatever the output format and narrows it itself
+        .source = format == GFX_FORMAT_RGB565 ? GFX_RGB565_TO_ARGB8888(color) : color,
+        .dest = (uint32_t) dest,
+        .width = width,
+        .height = height,
+        .output_offset = pitch - width,
+        .callback = callback,
+        .context = context,
+    };
+
+    if (pitch < width) {
+        return false;
+    }
+
+    return gfx_submit(&job);
+}
+
+bool gfx_fill_bytes(void *dest, size_t size, uint8_t value, gfx_callback_t callback, void *context)
+{
+    uint8_t *bytes = dest;
+    uint32_t color = value * 0x01010101u;
+    size_t row_size = GFX_FILL_ROW_PIXELS * 4;
+
+    // Fill the bulk as rows of 32-bit pixels, the callback goes with the last job so it runs once everything is done
+    size_t rows = size / row_size;
+    size_t tail_pixels = (size % row_size) / 4;
+    size_t tail_bytes = size % 4;
+
+    // Word alignment is required by DMA2D in ARGB8888, so let the CPU handle the odd case
+    if (((uint32_t) bytes & 3) != 0 || rows > GFX_MAX_HEIGHT) {
+        memset(bytes, value, size);
+        if (callback != NULL) {
+            callback(context);
+        }
+        return true;
+    }
+
+    memset(bytes + size - tail_bytes, value, tail_bytes);
+
+    bool last = tail_pixels == 0;
+    if (rows > 0 && !gfx_fill(bytes, GFX_FILL_ROW_PIXELS, rows, GFX_FILL_ROW_PIXELS, GFX_FORMAT_ARGB8888, color,
+                              last ? callback : NULL, context)) {
+        return false;
+    }
+
+    if (tail_pixels > 0) {
+        return gfx_fill(bytes + rows * row_size, tail_pixels, 1, tail_pixels, GFX_FORMAT_ARGB8888, color, callback,
+                        context);
+    }
+
+    if (rows == 0 && callback != NULL) {
+        callback(context);
+    }
+
+    return true;
+}
+
+bool gfx_copy(void *dest, uint16_t dest_pitch, const void *src, uint16_t src_pitch, uint16_t width, uint16_t height,
+              gfx_format_t format, gfx_callback_t callback, void *context)
+{
+    gfx_job_t job = {
+        .type = GFX_JOB_TRANSFER,
+        .mode = DMA2D_M2M,
+        .output_mode = gfx_output_mode(format),
+        .input_mode = gfx_input_mode(format),
+        .input_alpha = 0xFF,
+        .source = (uint32_t) src,
+        .dest = (uint32_t) dest,
+        .width = width,
+        .height = height,
+        .input_offset = src_pitch - width,
+        .output_offset = dest_pitch - width,
+        .callback = callback,
+        .context = context,
+    };
+
+    if (src_pitch < width || dest_pitch < width) {
+        return false;
+    }
+
+    return gfx_submit(&job);
+}
+
+bool gfx_convert(void *dest, uint16_t dest_pitch, gfx_format_t dest_format, const void *src, uint16_t src_pitch,
+                 gfx_format_t src_format, uint16_t width, uint16_t height, const uint32_t *clut, uint16_t clut_entries,
+                 gfx_callback_t callback, void *context)
+{
+    gfx_job_t job = {
+        .type = GFX_JOB_TRANSFER,
+        .mode = DMA2D_M2M_PFC,
+        .output_mode = gfx_output_mode(dest_format),
+        .input_mode = gfx_input_mode(src_format),
+        .input_alpha = 0xFF,
+        .source = (uint32_t) src,
+        .dest = (uint32_t) dest,
+        .width = width,
+        .height = height,
+        .input_offset = src_pitch - width,
+        .output_offset = dest_pitch - width,
+        .callback = callback,
+        .context = context,
+    };
+
+    if (src_pitch < width || dest_pitch < width || !gfx_is_output_format(dest_format)) {
+        return false;
+    }
+
+    // Indexed sources need their CLUT loaded first, as a job of its own so it stays in order
+    if (clut != NULL) {
+        gfx_job_t clut_job = {
+            .type = GFX_JOB_CLUT,
+            .mode = DMA2D_M2M_PFC,
+            .output_mode = job.output_mode,
+            .input_mode = job.input_mode,
+            .input_alpha = 0xFF,
+            .source = (uint32_t) clut,
+            .width = clut_entries,
+            .height = 1,
+        };
+
+        if (clut_entries == 0 || clut_entries > 256 || !gfx_submit(&clut_job)) {
+            return false;
+        }
+    }
+
+    return gfx_submit(&job);
+}
+
+bool gfx_blend(void *dest, uint16_t dest_pitch, gfx_format_t dest_format, const void *src, uint16_t src_pitch,
+               gfx_format_t src_format, uint16_t width, uint16_t height, uint32_t color, gfx_callback_t callback,
+               void *context)
+{
+    bool alpha_only = src_format == GFX_FORMAT_A8 || src_format == GFX_FORMAT_A4;
+    gfx_job_t job = {
+        .type = GFX_JOB_TRANSFER,
+        .mode = DMA2D_M2M_BLEND,
+        .output_mode = gfx_output_mode(dest_format),
+        .input_mode = gfx_input_mode(src_format),
+        .input_alpha = alpha_only ? color : color >> 24,
+        .source = (uint32_t) src,
+        .dest = (uint32_t) dest,
+        .width = width,
+        .height = height,
+        .input_offset = src_pitch - width,
+        .output_offset = dest_pitch - width,
+        .callback = callback,
+        .context = context,
+    };
+
+    if (src_pitch < width || dest_pitch < width || !gfx_is_output_format(dest_format) || src_format == GFX_FORMAT_L8 ||
+        src_format == GFX_FORMAT_L4) {
+        return false;
+    }
+
+    return gfx_submit(&job);
+}
+
+bool gfx_sync(gfx_callback_t callback, void *context)
+{
+    gfx_job_t job = {
+        .type = GFX_JOB_SYNC,
+        .callback = callback,
+        .context = context,
+    };
+
+    return gfx_submit(&job);
+}
+
+bool gfx_busy(void)
+{
+    return gfx_running;
+}
+
+void gfx_wait(void)
+{
+    // Jobs finish from the DMA2D interrupt
+    while (gfx_running) {
+    }
+}
+
+// CLUT loads finish through their own HAL callback
+void HAL_DMA2D_CLUTLoadingCpltCallback(DMA2D_HandleTypeDef *handle)
+{
+    (void) handle; // Suppress unused parameter warning
+    gfx_finish_job();
+}
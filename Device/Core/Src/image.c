@@ -1,71 +1,338 @@
 #include "image.h"
+#include "gfx.h"
+#include "log.h"
 #include "main.h"
-#include <stdio.h>
+#include "playback.h"
+#include "profile.h"
+#include <stdbool.h>
 #include <string.h>
 
 const uint16_t default_image_data[] = {
 #include "default_image_rgb565.h"
 };
 
-// Frame buffer in SDRAM - this will be placed first in the .sdram section
-uint16_t framebuffer[IMAGE_PIXEL_COUNT] __attribute__((section(".sdram")));
+// Front and back frame buffers in SDRAM - these will be placed first in the .sdram section. LTDC scans out the front
+// buffer while everything is drawn into the back one, and update_display() swaps them at vertical blanking.
+static uint16_t framebuffers[2][IMAGE_PIXEL_COUNT] __attribute__((section(".sdram")));
+static uint16_t *volatile front_buffer = framebuffers[0]; // Scanned out by LTDC, a frame buffer or an image slot
+static uint16_t *volatile pending_buffer = NULL;          // Waiting for the vertical blanking reload
+static volatile bool swap_programmed = false; // Pending address written, so the next reload event is the swap
+static uint32_t back_index = 1;
+static bool back_ready = false; // Back buffer holds the frame being drawn rather than the one before last
+
+// Preloaded full-screen images, shown by pointing LTDC at them
+static uint16_t image_slots[IMAGE_SLOT_COUNT][IMAGE_PIXEL_COUNT] __attribute__((section(".sdram")));
+static uint32_t stored_slots = 0; // One bit per slot holding a complete image
+
+// Indexed (L8/L4) images are received here and expanded into the back buffer by DMA2D
+static uint8_t index_buffer[IMAGE_PIXEL_COUNT] __attribute__((section(".sdram")));
+
+// Palette in the DMA2D CLUT layout (ARGB8888)
+static uint32_t palette[IMAGE_PALETTE_MAX_ENTRIES];
+static size_t palette_entries = 0;
 
 // External variables
 extern LTDC_HandleTypeDef hltdc;
 
+// Returns the buffer the next frame is drawn into. Partial updates need the frame on screen underneath, so the first
+// one after a swap queues a copy of the front buffer, whole frame writers skip it.
+static uint16_t *back_buffer(bool whole_frame)
+{
+    // Drawing takes the screen back from a running animation
+    playback_stop();
+
+    // The old front buffer is still scanned out until the pending swap lands
+    while (pending_buffer != NULL) {
+    }
+
+    uint16_t *back = framebuffers[back_index];
+    if (!back_ready && !whole_frame) {
+        gfx_copy(back, IMAGE_WIDTH, front_buffer, IMAGE_WIDTH, IMAGE_WIDTH, IMAGE_HEIGHT, GFX_FORMAT_RGB565, NULL,
+                 NULL);
+    }
+    back_ready = true;
+
+    return back;
+}
+
+// Runs once DMA2D has finished with the buffers queued before it, LTDC picks the new address (the context) up at
+// the next vertical blanking
+static void swap_buffers(void *context)
+{
+    HAL_LTDC_SetAddress_NoReload(&hltdc, (uint32_t) context, 0);
+    swap_programmed = true;
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+}
+
+// Queues LTDC to scan out another buffer, the next frame starts from a stale back buffer
+static bool present_buffer(uint16_t *buffer)
+{
+    playback_stop();
+
+    // Only one swap at a time, the back buffer is the old front buffer until it lands
+    while (pending_buffer != NULL) {
+    }
+
+    pending_buffer = buffer;
+    back_ready = false;
+    if (!gfx_sync(swap_buffers, buffer)) {
+        pending_buffer = NULL;
+        return false;
+    }
+
+    return true;
+}
+
 void display_init(void)
 {
     // Enable LCD backlight and display
     HAL_GPIO_WritePin(LCD_BL_CTRL_GPIO_Port, LCD_BL_CTRL_Pin, GPIO_PIN_SET);
     HAL_GPIO_WritePin(LCD_DISP_GPIO_Port, LCD_DISP_Pin, GPIO_PIN_SET);
 
-    // Set LTDC to use our framebuffer
-    HAL_LTDC_SetAddress(&hltdc, (uint32_t) framebuffer, 0);
+    // Start on a black front buffer
+    front_buffer = framebuffers[0];
+    back_index = 1;
+    gfx_fill(framebuffers[0], IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_WIDTH, GFX_FORMAT_RGB565, 0, NULL, NULL);
+    HAL_LTDC_SetAddress(&hltdc, (uint32_t) framebuffers[0], 0);
 
-    printf("Display initialized at address 0x%08lX\r\n", (uint32_t) framebuffer);
+    LOG_INFO("Display initialized with frame buffers at 0x%08lX and 0x%08lX\r\n", (uint32_t) framebuffers[0],
+             (uint32_t) framebuffers[1]);
 }
 
 void display_image(const uint16_t *image_data, size_t data_size)
 {
     if (data_size != IMAGE_DATA_SIZE) {
-        printf("USART6 Error: Invalid image data size %zu, expected %d\r\n", data_size, IMAGE_DATA_SIZE);
+        LOG_ERROR("USART6 Error: Invalid image data size %zu, expected %d\r\n", data_size, IMAGE_DATA_SIZE);
         return;
     }
 
-    // Copy image data to framebuffer
-    memcpy(framebuffer, image_data, IMAGE_DATA_SIZE);
+    // Copy image data to the back buffer, waiting because the caller may reuse its buffer once we return
+    gfx_copy(back_buffer(true), IMAGE_WIDTH, image_data, IMAGE_WIDTH, IMAGE_WIDTH, IMAGE_HEIGHT, GFX_FORMAT_RGB565,
+             NULL, NULL);
+    gfx_wait();
 
     // Update LTDC display
-    HAL_LTDC_SetAddress(&hltdc, (uint32_t) framebuffer, 0);
+    update_display();
 
-    printf("USART6 Display updated with new image (%lu bytes)\r\n", (unsigned long) data_size);
+    LOG_DEBUG("USART6 Display updated with new image (%lu bytes)\r\n", (unsigned long) data_size);
 }
 
-void display_default_image()
+void display_default_image(gfx_callback_t callback, void *context)
 {
-    // Copy default image data to framebuffer
-    memcpy(framebuffer, default_image_data, IMAGE_DATA_SIZE);
+    // The image lives in flash for good, so DMA2D copies it in the background and the callback runs once it is drawn
+    if (!gfx_copy(back_buffer(true), IMAGE_WIDTH, default_image_data, IMAGE_WIDTH, IMAGE_WIDTH, IMAGE_HEIGHT,
+                  GFX_FORMAT_RGB565, callback, context)) {
+        LOG_ERROR("Error: Failed to queue the default image\r\n");
+        return;
+    }
 
     // Update display
     update_display();
 
-    printf("Default image displayed (%lu bytes)\r\n", (unsigned long) IMAGE_DATA_SIZE);
+    LOG_INFO("Default image queued (%lu bytes)\r\n", (unsigned long) IMAGE_DATA_SIZE);
+}
+
+uint8_t *get_image_buffer(size_t size)
+{
+    // The rest of a shorter payload keeps the frame on screen. Callers write with the CPU, so let queued DMA2D jobs on
+    // the buffer, including that copy, finish first.
+    uint8_t *buffer = (uint8_t *) back_buffer(size == IMAGE_DATA_SIZE);
+    gfx_wait();
+    return buffer;
 }
 
-uint8_t *get_image_buffer(void)
+uint16_t *get_draw_buffer(void)
 {
-    return (uint8_t *) framebuffer;
+    // For DMA2D drawing on top of the current frame, which is queued behind the copy back_buffer() may add
+    return back_buffer(false);
 }
 
 void clear_image_buffer(void)
 {
-    memset(framebuffer, 0, IMAGE_DATA_SIZE);
-    printf("Image buffer cleared\r\n");
+    // Runs in the background, later CPU access goes through gfx_wait()
+    gfx_fill(back_buffer(true), IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_WIDTH, GFX_FORMAT_RGB565, 0, NULL, NULL);
+    LOG_DEBUG("Image buffer clear queued\r\n");
 }
 
 void update_display(void)
 {
-    // Update LTDC display
-    HAL_LTDC_SetAddress(&hltdc, (uint32_t) framebuffer, 0);
-    printf("Display updated\r\n");
-}
\ No newline at end of file
+    PROFILE_SCOPE(PROFILE_STAGE_DISPLAY);
+
+    // The swap waits behind the DMA2D jobs drawing this frame
+    if (!present_buffer(framebuffers[back_index])) {
+        LOG_ERROR("Error: Failed to queue the frame buffer swap\r\n");
+        return;
+    }
+
+    LOG_DEBUG("Display update queued\r\n");
+}
+
+void fill_image_rect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color)
+{
+    if (x + width > IMAGE_WIDTH || y + height > IMAGE_HEIGHT) {
+        LOG_ERROR("Error: Fill %ux%u at (%u, %u) is outside the framebuffer\r\n", width, height, x, y);
+        return;
+    }
+
+    uint16_t *back = back_buffer(false);
+    gfx_fill(&back[y * IMAGE_WIDTH + x], width, height, IMAGE_WIDTH, GFX_FORMAT_RGB565, color, NULL, NULL);
+}
+
+void display_region(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *data)
+{
+    if (x + width > IMAGE_WIDTH || y + height > IMAGE_HEIGHT) {
+        LOG_ERROR("Error: Region %ux%u at (%u, %u) is outside the framebuffer\r\n", width, height, x, y);
+        return;
+    }
+
+    uint16_t *back = back_buffer(false);
+
+    // DMA2D reads RGB565 a halfword at a time, so only an odd source address needs the CPU
+    if (((uint32_t) data & 1) == 0) {
+        gfx_copy(&back[y * IMAGE_WIDTH + x], IMAGE_WIDTH, data, width, width, height, GFX_FORMAT_RGB565, NULL,
+                 NULL);
+        return;
+    }
+
+    // Copy the packed RGB565 rows into the back buffer one row at a time
+    gfx_wait();
+    size_t row_size = width * sizeof(uint16_t);
+    for (uint16_t row = 0; row < height; row++) {
+        memcpy(&back[(y + row) * IMAGE_WIDTH + x], data + row * row_size, row_size);
+    }
+}
+
+void copy_image_region(uint16_t src_x, uint16_t src_y, uint16_t width, uint16_t height, uint16_t dest_x,
+                       uint16_t dest_y)
+{
+    if (src_x + width > IMAGE_WIDTH || src_y + height > IMAGE_HEIGHT || dest_x + width > IMAGE_WIDTH ||
+        dest_y + height > IMAGE_HEIGHT) {
+        LOG_ERROR("Error: Copy of %ux%u from (%u, %u) to (%u, %u) is outside the framebuffer\r\n", width, height, src_x,
+                  src_y, dest_x, dest_y);
+        return;
+    }
+
+    // Reading the frame on screen rather than the back buffer keeps overlapping copies (scrolling) correct
+    uint16_t *back = back_buffer(false);
+    gfx_copy(&back[dest_y * IMAGE_WIDTH + dest_x], IMAGE_WIDTH, &front_buffer[src_y * IMAGE_WIDTH + src_x],
+             IMAGE_WIDTH, width, height, GFX_FORMAT_RGB565, NULL, NULL);
+}
+
+uint8_t *get_index_buffer(void)
+{
+    // The previous conversion may still be reading the indices
+    gfx_wait();
+    return index_buffer;
+}
+
+void set_image_palette(const uint8_t *rgb888, size_t entries)
+{
+    if (entries > IMAGE_PALETTE_MAX_ENTRIES) {
+        entries = IMAGE_PALETTE_MAX_ENTRIES;
+    }
+
+    // A queued CLUT load reads the palette from here
+    gfx_wait();
+
+    for (size_t i = 0; i < entries; i++) {
+        palette[i] = 0xFF000000 | (rgb888[i * 3] << 16) | (rgb888[i * 3 + 1] << 8) | rgb888[i * 3 + 2];
+    }
+    palette_entries = entries;
+}
+
+void display_indexed(image_format_t format)
+{
+    gfx_format_t source_format = format == IMAGE_FORMAT_L4 ? GFX_FORMAT_L4 : GFX_FORMAT_L8;
+
+    // Expand the indices through the palette with a DMA2D pixel format conversion, which runs in the background
+    if (palette_entries == 0 ||
+        !gfx_convert(back_buffer(true), IMAGE_WIDTH, GFX_FORMAT_RGB565, index_buffer, IMAGE_WIDTH, source_format,
+                     IMAGE_WIDTH, IMAGE_HEIGHT, palette, palette_entries, NULL, NULL)) {
+        LOG_ERROR("Error: Failed to queue the DMA2D pixel format conversion\r\n");
+        return;
+    }
+
+    update_display();
+
+    LOG_DEBUG("%s image queued with %u palette entries\r\n", format == IMAGE_FORMAT_L4 ? "L4" : "L8",
+              (unsigned) palette_entries);
+}
+
+uint8_t *get_slot_buffer(uint32_t slot)
+{
+    if (slot >= IMAGE_SLOT_COUNT) {
+        return NULL;
+    }
+
+    // A slot on screen cannot be rewritten without tearing, and an animation may be about to show it
+    playback_stop();
+    while (pending_buffer != NULL) {
+    }
+    if (front_buffer == image_slots[slot]) {
+        return NULL;
+    }
+
+    // Queued copies may still read the old image, and the slot is incomplete until set_slot_stored()
+    gfx_wait();
+    stored_slots &= ~(1u << slot);
+
+    return (uint8_t *) image_slots[slot];
+}
+
+void set_slot_stored(uint32_t slot)
+{
+    if (slot < IMAGE_SLOT_COUNT) {
+        stored_slots |= 1u << slot;
+    }
+}
+
+bool show_slot(uint32_t slot)
+{
+    if (!is_slot_stored(slot)) {
+        return false;
+    }
+
+    // No copy, LTDC scans the slot out from the next vertical blanking
+    if (!present_buffer(image_slots[slot])) {
+        LOG_ERROR("Error: Failed to queue the switch to slot %lu\r\n", slot);
+        return false;
+    }
+
+    LOG_DEBUG("Slot %lu queued for display\r\n", slot);
+    return true;
+}
+
+bool is_slot_stored(uint32_t slot)
+{
+    return slot < IMAGE_SLOT_COUNT && (stored_slots & (1u << slot)) != 0;
+}
+
+// Playback's timer interrupt has the same priority as LTDC's, so the reload event cannot land in the middle of this
+bool show_slot_from_isr(uint32_t slot)
+{
+    if (!is_slot_stored(slot) || pending_buffer != NULL) {
+        return false;
+    }
+
+    pending_buffer = image_slots[slot];
+    back_ready = false;
+    swap_buffers(image_slots[slot]);
+    return true;
+}
+
+// The vertical blanking reload has taken the new address, when that was the back buffer the buffers trade places.
+// Overlay changes reload too, those leave the frame buffers alone.
+void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *handle)
+{
+    (void) handle; // Suppress unused parameter warning
+    if (!swap_programmed) {
+        return;
+    }
+
+    swap_programmed = false;
+    front_buffer = pending_buffer;
+    if (front_buffer == framebuffers[back_index]) {
+        back_index ^= 1;
+    }
+    pending_buffer = NULL;
+}
@@ -0,0 +1,211 @@
+#include "log.h"
+#include "main.h"
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+// Private variables ---------------------------------------------------------------------------------------------------
+
+// DTCM is never cached, so the DMA reads what the writers left without any cache maintenance
+static char log_buffer[LOG_BUFFER_SIZE] __attribute__((section(".dtcm")));
+
+// Free-running byte counts, masked into the ring. Writers claim space by moving reserved and publish it by moving
+// committed, and sent follows the DMA.
+static volatile uint32_t log_reserved __attribute__((section(".dtcm")));
+static volatile uint32_t log_committed __attribute__((section(".dtcm")));
+static volatile uint32_t log_sent __attribute__((section(".dtcm")));
+static volatile uint32_t log_writers __attribute__((section(".dtcm"))); // Writers between claim and publish
+static volatile uint32_t log_drops __attribute__((section(".dtcm")));
+
+static volatile bool log_tx_busy = false; // Claimed by whoever starts a transfer
+static volatile uint32_t log_tx_length = 0;
+static bool log_ready = false;
+
+// External variables --------------------------------------------------------------------------------------------------
+
+extern UART_HandleTypeDef huart1;
+
+// Private functions ---------------------------------------------------------------------------------------------------
+
+// Sends the committed bytes up to the end of the ring, the rest follows from the completion callback
+static void log_kick(void)
+{
+    while (log_ready) {
+        bool idle = false;
+        if (!__atomic_compare_exchange_n(&log_tx_busy, &idle, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            return;
+        }
+
+        uint32_t sent = log_sent;
+        uint32_t offset = sent % LOG_BUFFER_SIZE;
+        uint32_t length = __atomic_load_n(&log_committed, __ATOMIC_ACQUIRE) - sent;
+        if (length > LOG_BUFFER_SIZE - offset) {
+            length = LOG_BUFFER_SIZE - offset;
+        }
+
+        if (length > 0) {
+            log_tx_length = length;
+            if (HAL_UART_Transmit_DMA(&huart1, (uint8_t *) &log_buffer[offset], length) == HAL_OK) {
+                return;
+            }
+            log_sent = sent + length; // A refused transfer loses its bytes rather than blocking the ring
+        }
+
+        // A writer that published while the DMA was claimed left its bytes to us, so look again after releasing it
+        __atomic_store_n(&log_tx_busy, false, __ATOMIC_RELEASE);
+        if (__atomic_load_n(&log_committed, __ATOMIC_ACQUIRE) == log_sent) {
+            return;
+        }
+    }
+}
+
+// Appends a LEB128 varint, seven bits per byte with the high bit set on all but the last
+static void log_append_varint(log_record_t *record, uint32_t value)
+{
+    do {
+        if (record->length == LOG_TRACE_RECORD_MAX) {
+            return;
+        }
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        record->data[record->length++] = value != 0 ? byte | 0x80 : byte;
+    } while (value != 0);
+}
+
+// Public functions ----------------------------------------------------------------------------------------------------
+
+void log_init(void)
+{
+    // The USART1 TX DMA stream and its interrupts are set up by HAL_UART_MspInit()
+    log_ready = true;
+    log_kick();
+}
+
+void log_printf(const char *format, ...)
+{
+    char line[LOG_LINE_MAX];
+    va_list args;
+
+    va_start(args, format);
+    int length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+
+    if (length < 0) {
+        return;
+    }
+    if ((size_t) length >= sizeof(line)) {
+        length = sizeof(line) - 1;
+    }
+
+    log_write(line, (size_t) length);
+}
+
+size_t log_write(const char *data, size_t length)
+{
+    __atomic_add_fetch(&log_writers, 1, __ATOMIC_ACQUIRE);
+
+    // Claim space, anything between sent and reserved is still in use
+    uint32_t start = __atomic_load_n(&log_reserved, __ATOMIC_RELAXED);
+    bool fits;
+    do {
+        fits = length <= LOG_BUFFER_SIZE - (start - log_sent);
+    } while (fits && !__atomic_compare_exchange_n(&log_reserved, &start, start + length, true, __ATOMIC_ACQ_REL,
+                                                  __ATOMIC_RELAXED));
+
+    if (fits) {
+        // Copy in at most two runs, splitting where the ring wraps
+        uint32_t offset = start % LOG_BUFFER_SIZE;
+        size_t first = LOG_BUFFER_SIZE - offset < length ? LOG_BUFFER_SIZE - offset : length;
+        memcpy(&log_buffer[offset], data, first);
+        memcpy(log_buffer, data + first, length - first);
+    }
+    else {
+        __atomic_add_fetch(&log_drops, 1, __ATOMIC_RELAXED);
+    }
+
+    // The last writer out publishes everything claimed so far. Writers that interrupted it have finished their copies,
+    // and one that interrupts it from here on publishes for itself, so committed only moves forward.
+    if (__atomic_sub_fetch(&log_writers, 1, __ATOMIC_ACQ_REL) == 0) {
+        uint32_t reserved = __atomic_load_n(&log_reserved, __ATOMIC_ACQUIRE);
+        uint32_t committed = __atomic_load_n(&log_committed, __ATOMIC_RELAXED);
+        while ((int32_t) (reserved - committed) > 0 &&
+               !__atomic_compare_exchange_n(&log_committed, &committed, reserved, true, __ATOMIC_RELEASE,
+                                            __ATOMIC_RELAXED)) {
+        }
+    }
+
+    log_kick();
+    return fits ? length : 0;
+}
+
+uint32_t log_dropped(void)
+{
+    return log_drops;
+}
+
+// The format's address is its offset in .log_strings, which the linker places at 0
+void log_record_begin(log_record_t *record, const char *format)
+{
+    uint16_t id = (uint16_t) (uintptr_t) format;
+
+    record->data[0] = LOG_TRACE_SYNC;
+    record->data[2] = (uint8_t) (id & 0xFF);
+    record->data[3] = (uint8_t) (id >> 8);
+    record->length = 4;
+    log_append_varint(record, HAL_GetTick());
+}
+
+void log_arg_word(log_record_t *record, uint32_t value)
+{
+    log_append_varint(record, value);
+}
+
+void log_arg_float(log_record_t *record, double value)
+{
+    float single = (float) value;
+
+    if (LOG_TRACE_RECORD_MAX - record->length >= sizeof(single)) {
+        memcpy(&record->data[record->length], &single, sizeof(single));
+        record->length += sizeof(single);
+    }
+}
+
+void log_arg_string(log_record_t *record, const char *value)
+{
+    size_t room = LOG_TRACE_RECORD_MAX - record->length;
+    if (room == 0) {
+        return;
+    }
+
+    size_t length = strnlen(value, LOG_TRACE_STRING_MAX < room - 1 ? LOG_TRACE_STRING_MAX : room - 1);
+    record->data[record->length++] = (uint8_t) length;
+    memcpy(&record->data[record->length], value, length);
+    record->length += length;
+}
+
+// An argument that did not fit leaves the record short, which the decoder reports
+void log_record_end(log_record_t *record)
+{
+    record->data[1] = (uint8_t) (record->length - 2);
+    log_write((const char *) record->data, record->length);
+}
+
+// printf and anything else on stdout goes through the ring too
+int _write(int file, char *ptr, int len)
+{
+    (void) file; // Suppress unused parameter warning
+    log_write(ptr, (size_t) len);
+    return len;
+}
+
+void log_tx_complete(void)
+{
+    if (!log_tx_busy) {
+        return;
+    }
+
+    log_sent += log_tx_length;
+    __atomic_store_n(&log_tx_busy, false, __ATOMIC_RELEASE);
+    log_kick();
+}
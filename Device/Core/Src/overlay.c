@@ -0,0 +1,162 @@
+#include "overlay.h"
+#include "image.h"
+#include "log.h"
+#include "main.h"
+
+// Private macros ------------------------------------------------------------------------------------------------------
+
+#define OVERLAY_LAYER 1
+
+// Private variables ---------------------------------------------------------------------------------------------------
+
+// Two buffers so a new image never overwrites the one LTDC is scanning out
+static uint8_t overlay_buffers[2][OVERLAY_BUFFER_SIZE] __attribute__((section(".sdram"), aligned(4)));
+static uint32_t overlay_back = 0;
+
+// Layer 1 configuration, applied once the first image is committed
+static LTDC_LayerCfgTypeDef overlay_layer = {
+    .PixelFormat = LTDC_PIXEL_FORMAT_RGB565,
+    .Alpha = 255,
+    .Alpha0 = 0,
+    .BlendingFactor1 = LTDC_BLENDING_FACTOR1_PAxCA,
+    .BlendingFactor2 = LTDC_BLENDING_FACTOR2_PAxCA,
+};
+static bool overlay_visible = false;
+static bool overlay_keyed = false;
+static uint32_t overlay_key = 0; // RGB888
+
+// Upload in progress
+static uint16_t upload_x, upload_y, upload_width, upload_height;
+static overlay_format_t upload_format;
+
+// External variables --------------------------------------------------------------------------------------------------
+
+extern LTDC_HandleTypeDef hltdc;
+
+// Private functions ---------------------------------------------------------------------------------------------------
+
+// The layer registers are shared with the frame buffer swap in the DMA2D interrupt, and a HAL call that finds the
+// handle locked there would fail, so changes are made with interrupts off and latched at the next vertical blanking
+static uint32_t overlay_lock(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static void overlay_unlock(uint32_t primask)
+{
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+    __set_PRIMASK(primask);
+}
+
+static void overlay_apply_color_key(void)
+{
+    if (overlay_keyed) {
+        HAL_LTDC_ConfigColorKeying_NoReload(&hltdc, overlay_key, OVERLAY_LAYER);
+        HAL_LTDC_EnableColorKeying_NoReload(&hltdc, OVERLAY_LAYER);
+    }
+    else {
+        HAL_LTDC_DisableColorKeying_NoReload(&hltdc, OVERLAY_LAYER);
+    }
+}
+
+// Public functions ----------------------------------------------------------------------------------------------------
+
+size_t overlay_image_size(uint16_t width, uint16_t height, overlay_format_t format)
+{
+    return (size_t) width * height * (format == OVERLAY_FORMAT_ARGB8888 ? 4 : 2);
+}
+
+uint8_t *overlay_begin_upload(uint16_t x, uint16_t y, uint16_t width, uint16_t height, overlay_format_t format)
+{
+    if (width == 0 || height == 0 || x + width > IMAGE_WIDTH || y + height > IMAGE_HEIGHT ||
+        overlay_image_size(width, height, format) > OVERLAY_BUFFER_SIZE) {
+        LOG_ERROR("Error: Overlay %ux%u at (%u, %u) does not fit\r\n", width, height, x, y);
+        return NULL;
+    }
+
+    // The back buffer was on screen until the last reload landed
+    while ((hltdc.Instance->SRCR & LTDC_SRCR_VBR) != 0) {
+    }
+
+    upload_x = x;
+    upload_y = y;
+    upload_width = width;
+    upload_height = height;
+    upload_format = format;
+
+    return overlay_buffers[overlay_back];
+}
+
+void overlay_commit_upload(void)
+{
+    overlay_layer.WindowX0 = upload_x;
+    overlay_layer.WindowX1 = upload_x + upload_width;
+    overlay_layer.WindowY0 = upload_y;
+    overlay_layer.WindowY1 = upload_y + upload_height;
+    overlay_layer.ImageWidth = upload_width;
+    overlay_layer.ImageHeight = upload_height;
+    overlay_layer.PixelFormat =
+        upload_format == OVERLAY_FORMAT_ARGB8888 ? LTDC_PIXEL_FORMAT_ARGB8888 : LTDC_PIXEL_FORMAT_RGB565;
+    overlay_layer.FBStartAdress = (uint32_t) overlay_buffers[overlay_back];
+
+    uint32_t primask = overlay_lock();
+    HAL_LTDC_ConfigLayer_NoReload(&hltdc, &overlay_layer, OVERLAY_LAYER);
+    overlay_apply_color_key();
+    overlay_unlock(primask);
+
+    overlay_back ^= 1;
+    overlay_visible = true;
+
+    LOG_DEBUG("Overlay %ux%u at (%u, %u) queued\r\n", upload_width, upload_height, upload_x, upload_y);
+}
+
+bool overlay_move(uint16_t x, uint16_t y)
+{
+    if (x + overlay_layer.ImageWidth > IMAGE_WIDTH || y + overlay_layer.ImageHeight > IMAGE_HEIGHT) {
+        LOG_ERROR("Error: Overlay cannot move to (%u, %u)\r\n", x, y);
+        return false;
+    }
+
+    overlay_layer.WindowX0 = x;
+    overlay_layer.WindowX1 = x + overlay_layer.ImageWidth;
+    overlay_layer.WindowY0 = y;
+    overlay_layer.WindowY1 = y + overlay_layer.ImageHeight;
+
+    if (overlay_visible) {
+        uint32_t primask = overlay_lock();
+        HAL_LTDC_SetWindowPosition_NoReload(&hltdc, x, y, OVERLAY_LAYER);
+        overlay_unlock(primask);
+    }
+
+    return true;
+}
+
+void overlay_set_alpha(uint8_t alpha)
+{
+    overlay_layer.Alpha = alpha;
+
+    if (overlay_visible) {
+        uint32_t primask = overlay_lock();
+        HAL_LTDC_SetAlpha_NoReload(&hltdc, alpha, OVERLAY_LAYER);
+        overlay_unlock(primask);
+    }
+}
+
+void overlay_set_color_key(bool enabled, uint16_t color)
+{
+    // LTDC compares against the pixel expanded to RGB888, which replicates the top bits into the low ones
+    uint32_t red = (color >> 11) & 0x1F;
+    uint32_t green = (color >> 5) & 0x3F;
+    uint32_t blue = color & 0x1F;
+
+    overlay_keyed = enabled;
+    overlay_key = ((red << 3 | red >> 2) << 16) | ((green << 2 | green >> 4) << 8) | (blue << 3 | blue >> 2);
+
+    if (overlay_visible) {
+        uint32_t primask = overlay_lock();
+        overlay_apply_color_key();
+        overlay_unlock(primask);
+    }
+}
@@ -0,0 +1,109 @@
+#include "playback.h"
+#include "image.h"
+#include "log.h"
+#include "main.h"
+
+// Private variables ---------------------------------------------------------------------------------------------------
+
+// TIM7 is a basic timer that CubeMX leaves free, the PWM timers keep their Arduino header pins
+TIM_HandleTypeDef htim7;
+
+static uint8_t sequence[PLAYBACK_MAX_FRAMES];
+static size_t sequence_length = 0;
+static volatile size_t next_frame = 0;
+static volatile bool looping = false;
+static volatile bool playing = false;
+
+// Public functions ----------------------------------------------------------------------------------------------------
+
+void playback_init(void)
+{
+    // APB1 runs at a quarter of HCLK, so its timers are clocked at twice PCLK1
+    uint32_t timer_clock = HAL_RCC_GetPCLK1Freq() * 2;
+
+    __HAL_RCC_TIM7_CLK_ENABLE();
+
+    htim7.Instance = TIM7;
+    htim7.Init.Prescaler = timer_clock / PLAYBACK_TICK_HZ - 1;
+    htim7.Init.CounterMode = TIM_COUNTERMODE_UP;
+    htim7.Init.Period = PLAYBACK_TICK_HZ - 1;
+    htim7.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    if (HAL_TIM_Base_Init(&htim7) != HAL_OK) {
+        Error_Handler();
+    }
+
+    // Same priority as LTDC, so a frame switch and the reload event that completes it never interrupt each other
+    HAL_NVIC_SetPriority(TIM7_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(TIM7_IRQn);
+}
+
+bool playback_start(const uint8_t *slots, size_t count, uint32_t fps, bool loop)
+{
+    if (count == 0 || count > PLAYBACK_MAX_FRAMES || fps == 0 || fps > PLAYBACK_MAX_FPS) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!is_slot_stored(slots[i])) {
+            LOG_ERROR("Error: Sequence frame %zu is empty slot %u\r\n", i, slots[i]);
+            return false;
+        }
+    }
+
+    playback_stop();
+
+    for (size_t i = 0; i < count; i++) {
+        sequence[i] = slots[i];
+    }
+    sequence_length = count;
+    next_frame = 1;
+    looping = loop;
+
+    // The first frame goes up straight away, the timer brings in the rest
+    if (!show_slot(sequence[0])) {
+        return false;
+    }
+    if (count == 1) {
+        return true;
+    }
+
+    __HAL_TIM_SET_AUTORELOAD(&htim7, PLAYBACK_TICK_HZ / fps - 1);
+    __HAL_TIM_SET_COUNTER(&htim7, 0);
+    __HAL_TIM_CLEAR_FLAG(&htim7, TIM_FLAG_UPDATE);
+    playing = true;
+    HAL_TIM_Base_Start_IT(&htim7);
+
+    LOG_INFO("Playing %zu frames at %lu fps%s\r\n", count, fps, loop ? ", looped" : "");
+    return true;
+}
+
+void playback_stop(void)
+{
+    if (!playing) {
+        return;
+    }
+
+    HAL_TIM_Base_Stop_IT(&htim7);
+    playing = false;
+    LOG_INFO("Playback stopped\r\n");
+}
+
+bool playback_is_playing(void)
+{
+    return playing;
+}
+
+void playback_tick(void)
+{
+    if (next_frame == sequence_length) {
+        if (!looping) {
+            HAL_TIM_Base_Stop_IT(&htim7);
+            playing = false;
+            return;
+        }
+        next_frame = 0;
+    }
+
+    if (show_slot_from_isr(sequence[next_frame])) {
+        next_frame++;
+    }
+}
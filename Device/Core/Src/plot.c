@@ -0,0 +1,111 @@
+#include "plot.h"
+#include "image.h"
+#include "log.h"
+
+// Private types -------------------------------------------------------------------------------------------------------
+
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    int32_t min;
+    int32_t max;
+    uint16_t color;
+    uint16_t background;
+    uint16_t last_row; // Row of the newest sample, where the next column's line starts
+    bool has_last;     // No samples yet, so the first one is drawn as a single point
+    bool created;
+} plot_t;
+
+// Private variables ---------------------------------------------------------------------------------------------------
+
+static plot_t plots[PLOT_MAX_COUNT];
+
+// Private functions ---------------------------------------------------------------------------------------------------
+
+// Maps a sample to a screen row, with min on the bottom row and max on the top one
+static uint16_t plot_row(const plot_t *plot, int32_t sample)
+{
+    if (sample <= plot->min) {
+        return plot->y + plot->height - 1;
+    }
+    if (sample >= plot->max) {
+        return plot->y;
+    }
+
+    int64_t offset = (((int64_t) sample - plot->min) * (plot->height - 1)) / ((int64_t) plot->max - plot->min);
+    return plot->y + plot->height - 1 - (uint16_t) offset;
+}
+
+// Public functions ----------------------------------------------------------------------------------------------------
+
+bool plot_create(uint32_t id, uint16_t x, uint16_t y, uint16_t width, uint16_t height, int32_t min, int32_t max,
+                 uint16_t color, uint16_t background)
+{
+    if (id >= PLOT_MAX_COUNT || width == 0 || height == 0 || x >= IMAGE_WIDTH || y >= IMAGE_HEIGHT ||
+        width > IMAGE_WIDTH - x || height > IMAGE_HEIGHT - y || min >= max) {
+        LOG_ERROR("Error: Invalid plot %lu (%ux%u at %u, %u)\r\n", id, width, height, x, y);
+        return false;
+    }
+
+    plots[id] = (plot_t) {
+        .x = x,
+        .y = y,
+        .width = width,
+        .height = height,
+        .min = min,
+        .max = max,
+        .color = color,
+        .background = background,
+        .has_last = false,
+        .created = true,
+    };
+
+    fill_image_rect(x, y, width, height, background);
+    return true;
+}
+
+bool plot_append(uint32_t id, const int32_t *samples, size_t count)
+{
+    if (id >= PLOT_MAX_COUNT || !plots[id].created) {
+        return false;
+    }
+
+    plot_t *plot = &plots[id];
+
+    // Only the newest width samples are visible, the line into the first of them starts from the one before
+    size_t shift = count < plot->width ? count : plot->width;
+    if (count > shift) {
+        plot->last_row = plot_row(plot, samples[count - shift - 1]);
+        plot->has_last = true;
+    }
+    samples += count - shift;
+    if (shift == 0) {
+        return true;
+    }
+
+    if (shift < plot->width) {
+        copy_image_region(plot->x + shift, plot->y, plot->width - shift, plot->height, plot->x, plot->y);
+    }
+
+    uint16_t column = plot->x + plot->width - shift;
+    fill_image_rect(column, plot->y, shift, plot->height, plot->background);
+
+    for (size_t i = 0; i < shift; i++) {
+        uint16_t row = plot_row(plot, samples[i]);
+        uint16_t top = row;
+        uint16_t bottom = row;
+
+        if (plot->has_last) {
+            top = row < plot->last_row ? row : plot->last_row;
+            bottom = row < plot->last_row ? plot->last_row : row;
+        }
+
+        fill_image_rect(column + i, top, 1, bottom - top + 1, plot->color);
+        plot->last_row = row;
+        plot->has_last = true;
+    }
+
+    return true;
+}
@@ -0,0 +1,111 @@
+#include "render.h"
+#include "asset.h"
+#include "gfx.h"
+#include "image.h"
+#include "text.h"
+#include <stdio.h>
+#include <string.h>
+
+// Private types -------------------------------------------------------------------------------------------------------
+
+typedef struct {
+    const char *name;
+    uint8_t min_args;
+    uint8_t max_args;
+    bool has_data;
+} render_op_info_t;
+
+// Private variables ---------------------------------------------------------------------------------------------------
+
+static const render_op_info_t render_ops[RENDER_OP_COUNT] = {
+    [RENDER_FILL_RECT] = {"fill_rect", 5, 5, false},
+    [RENDER_DRAW_ASSET] = {"draw_asset", 3, 4, false},
+    [RENDER_COPY_REGION] = {"copy_region", 6, 6, false},
+    [RENDER_REGION] = {"region", 4, 4, true},
+    [RENDER_DRAW_TEXT] = {"draw_text", 4, 4, true},
+};
+
+// Private functions ---------------------------------------------------------------------------------------------------
+
+// Checks that a width x height rectangle at (x, y) is non-empty and inside the screen
+static bool render_rect_fits(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    return width > 0 && height > 0 && x < IMAGE_WIDTH && y < IMAGE_HEIGHT && width <= IMAGE_WIDTH - x &&
+           height <= IMAGE_HEIGHT - y;
+}
+
+// Public functions ----------------------------------------------------------------------------------------------------
+
+bool render_find_op(const char *name, render_op_t *op)
+{
+    for (int i = 0; i < RENDER_OP_COUNT; i++) {
+        if (strcmp(render_ops[i].name, name) == 0) {
+            *op = (render_op_t) i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool render_check(const render_command_t *command)
+{
+    const render_op_info_t *info = &render_ops[command->op];
+    const uint32_t *args = command->args;
+
+    if (command->arg_count < info->min_args || command->arg_count > info->max_args ||
+        (command->data != NULL) != info->has_data) {
+        return false;
+    }
+
+    switch (command->op) {
+    case RENDER_FILL_RECT:
+        return render_rect_fits(args[0], args[1], args[2], args[3]) && args[4] <= 0xFFFF;
+    case RENDER_DRAW_ASSET: {
+        const asset_t *asset = asset_get(args[0]);
+        return asset != NULL && render_rect_fits(args[1], args[2], asset->width, asset->height);
+    }
+    case RENDER_COPY_REGION:
+        return render_rect_fits(args[0], args[1], args[2], args[3]) &&
+               render_rect_fits(args[4], args[5], args[2], args[3]);
+    case RENDER_REGION:
+        return render_rect_fits(args[0], args[1], args[2], args[3]) &&
+               command->data_length == args[2] * args[3] * sizeof(uint16_t);
+    case RENDER_DRAW_TEXT: {
+        const font_t *font = text_get_font(args[2]);
+        return font != NULL && render_rect_fits(args[0], args[1], 1, font->height) && args[3] <= 0xFFFF;
+    }
+    default:
+        return false;
+    }
+}
+
+void render_execute(const render_command_t *commands, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        const uint32_t *args = commands[i].args;
+
+        switch (commands[i].op) {
+        case RENDER_FILL_RECT:
+            fill_image_rect(args[0], args[1], args[2], args[3], args[4]);
+            break;
+        case RENDER_DRAW_ASSET:
+            asset_draw(args[0], args[1], args[2], commands[i].arg_count > 3 ? args[3] : 0xFFFFFFFF);
+            break;
+        case RENDER_COPY_REGION:
+            copy_image_region(args[0], args[1], args[2], args[3], args[4], args[5]);
+            break;
+        case RENDER_REGION:
+            display_region(args[0], args[1], args[2], args[3], commands[i].data);
+            break;
+        case RENDER_DRAW_TEXT:
+            text_draw(args[0], args[1], args[2], args[3], (const char *) commands[i].data, commands[i].data_length);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // One swap for the whole list, queued behind its DMA2D jobs
+    update_display();
+}
@@ -0,0 +1,349 @@
+#include "rpc_parser.h"
+#include <string.h>
+
+// Private macros ------------------------------------------------------------------------------------------------------
+
+#define CBOR_MAJOR_UNSIGNED 0
+#define CBOR_MAJOR_NEGATIVE 1
+#define CBOR_MAJOR_BYTES 2
+#define CBOR_MAJOR_TEXT 3
+#define CBOR_MAJOR_ARRAY 4
+#define CBOR_MAJOR_MAP 5
+#define CBOR_MAJOR_TAG 6
+#define CBOR_MAJOR_SIMPLE 7
+
+// Private types -------------------------------------------------------------------------------------------------------
+
+typedef enum {
+    ROLE_ROOT,        // The root map itself
+    ROLE_ROOT_KEY,    // A key of the root map
+    ROLE_METHOD,      // The value of "method"
+    ROLE_PARAMS,      // The value of "params"
+    ROLE_ROOT_VALUE,  // Any other root value
+    ROLE_PARAM_KEY,   // A key of the params map
+    ROLE_PARAM_VALUE, // A value of the params map
+    ROLE_SKIP,        // Anything nested deeper, or trailing data
+} item_role_t;
+
+typedef enum {
+    ROOT_KEY_OTHER,
+    ROOT_KEY_METHOD,
+    ROOT_KEY_PARAMS,
+} root_key_t;
+
+// Private functions ---------------------------------------------------------------------------------------------------
+
+static void fail(rpc_parser_t *parser)
+{
+    parser->cbor_error = true;
+    parser->state = RPC_PARSER_STATE_BODY_ONLY;
+}
+
+static void copy_text(const rpc_parser_t *parser, char *dest)
+{
+    // Names longer than the buffer can never match, so store them as empty
+    if (parser->text_truncated) {
+        dest[0] = '\0';
+        return;
+    }
+
+    memcpy(dest, parser->text, parser->text_length);
+    dest[parser->text_length] = '\0';
+}
+
+static void end_item(rpc_parser_t *parser)
+{
+    switch (parser->role) {
+    case ROLE_ROOT_KEY:
+        if (!parser->text_truncated && strcmp(parser->text, "method") == 0) {
+            parser->root_key = ROOT_KEY_METHOD;
+        }
+        else if (!parser->text_truncated && strcmp(parser->text, "params") == 0) {
+            parser->root_key = ROOT_KEY_PARAMS;
+        }
+        else {
+            parser->root_key = ROOT_KEY_OTHER;
+        }
+        break;
+    case ROLE_METHOD:
+        copy_text(parser, parser->method);
+        parser->has_method = true;
+        break;
+    case ROLE_PARAM_KEY:
+        copy_text(parser, parser->param_name);
+        break;
+    default:
+        break;
+    }
+
+    parser->state = RPC_PARSER_STATE_HEADER;
+
+    if (parser->skip_items > 0) {
+        return;
+    }
+
+    // Close the params map and then the root map once all of their items are consumed
+    if (parser->in_params && parser->params_items == 0) {
+        parser->in_params = false;
+    }
+
+    if (parser->root_started && !parser->in_params && parser->root_items == 0) {
+        parser->cbor_complete = true;
+    }
+}
+
+static void begin_item(rpc_parser_t *parser)
+{
+    if (!parser->root_started) {
+        parser->role = ROLE_ROOT;
+    }
+    else if (parser->skip_items > 0) {
+        parser->role = ROLE_SKIP;
+        parser->skip_items--;
+    }
+    else if (parser->in_params) {
+        parser->role = (parser->params_items % 2 == 0) ? ROLE_PARAM_KEY : ROLE_PARAM_VALUE;
+        parser->params_items--;
+    }
+    else if (parser->root_items > 0) {
+        if (parser->root_items % 2 == 0) {
+            parser->role = ROLE_ROOT_KEY;
+        }
+        else if (parser->root_key == ROOT_KEY_METHOD) {
+            parser->role = ROLE_METHOD;
+        }
+        else if (parser->root_key == ROOT_KEY_PARAMS) {
+            parser->role = ROLE_PARAMS;
+        }
+        else {
+            parser->role = ROLE_ROOT_VALUE;
+        }
+        parser->root_items--;
+    }
+    else {
+        // Data after the root map
+        parser->role = ROLE_SKIP;
+        parser->cbor_error = true;
+    }
+}
+
+static rpc_parser_event_t on_header(rpc_parser_t *parser)
+{
+    uint8_t role = parser->role;
+    uint8_t major_type = parser->major_type;
+    bool is_key = (role == ROLE_ROOT_KEY || role == ROLE_PARAM_KEY);
+
+    if (major_type == CBOR_MAJOR_BYTES || major_type == CBOR_MAJOR_TEXT) {
+        // Keys and the method name must be text, and a string can never outrun its frame
+        if (((is_key || role == ROLE_METHOD) && major_type != CBOR_MAJOR_TEXT) || role == ROLE_ROOT ||
+            parser->argument > parser->message_length - parser->offset) {
+            fail(parser);
+            return RPC_PARSER_NEED_MORE;
+        }
+
+        parser->string_remaining = (uint32_t) parser->argument;
+        parser->text_length = 0;
+        parser->text_truncated = false;
+        memset(parser->text, 0, sizeof(parser->text));
+
+        if (parser->string_remaining == 0) {
+            end_item(parser);
+            return RPC_PARSER_NEED_MORE;
+        }
+
+        parser->state = RPC_PARSER_STATE_STRING;
+
+        if (role == ROLE_PARAM_VALUE && major_type == CBOR_MAJOR_BYTES) {
+            parser->param_length = parser->string_remaining;
+            parser->param_offset = parser->offset;
+            parser->param_header_offset = parser->item_offset;
+            return RPC_PARSER_PARAM_BYTES;
+        }
+
+        return RPC_PARSER_NEED_MORE;
+    }
+
+    if (major_type == CBOR_MAJOR_ARRAY || major_type == CBOR_MAJOR_MAP) {
+        // Every item takes at least one byte, which bounds the count before doubling it for maps
+        if (is_key || role == ROLE_METHOD || parser->argument > parser->message_length) {
+            fail(parser);
+            return RPC_PARSER_NEED_MORE;
+        }
+
+        uint32_t items = (uint32_t) parser->argument * (major_type == CBOR_MAJOR_MAP ? 2 : 1);
+
+        if (role == ROLE_ROOT) {
+            if (major_type != CBOR_MAJOR_MAP) {
+                fail(parser);
+                return RPC_PARSER_NEED_MORE;
+            }
+            parser->root_started = true;
+            parser->root_items = items;
+        }
+        else if (role == ROLE_PARAMS && major_type == CBOR_MAJOR_MAP) {
+            parser->has_params = true;
+            parser->in_params = true;
+            parser->params_items = items;
+        }
+        else {
+            parser->skip_items += items;
+        }
+
+        end_item(parser);
+        return RPC_PARSER_NEED_MORE;
+    }
+
+    if (major_type == CBOR_MAJOR_TAG) {
+        // The tagged item takes the tag's place
+        if (is_key || role == ROLE_METHOD || role == ROLE_ROOT) {
+            fail(parser);
+            return RPC_PARSER_NEED_MORE;
+        }
+        parser->skip_items++;
+        end_item(parser);
+        return RPC_PARSER_NEED_MORE;
+    }
+
+    // Integers and simple values
+    if (is_key || role == ROLE_METHOD || role == ROLE_ROOT) {
+        fail(parser);
+        return RPC_PARSER_NEED_MORE;
+    }
+
+    end_item(parser);
+    return RPC_PARSER_NEED_MORE;
+}
+
+static rpc_parser_event_t parse_byte(rpc_parser_t *parser, uint8_t byte)
+{
+    switch (parser->state) {
+    case RPC_PARSER_STATE_HEADER: {
+        uint8_t additional_info = byte & 0x1F;
+
+        parser->major_type = byte >> 5;
+        parser->argument = additional_info;
+        parser->item_offset = parser->offset - 1;
+        begin_item(parser);
+
+        if (additional_info < 24) {
+            return on_header(parser);
+        }
+
+        // Indefinite lengths (31) and reserved values (28-30) are not supported
+        if (additional_info > 27) {
+            fail(parser);
+            return RPC_PARSER_NEED_MORE;
+        }
+
+        parser->argument = 0;
+        parser->argument_bytes = 1u << (additional_info - 24);
+        parser->state = RPC_PARSER_STATE_ARGUMENT;
+        return RPC_PARSER_NEED_MORE;
+    }
+
+    case RPC_PARSER_STATE_ARGUMENT:
+        parser->argument = (parser->argument << 8) | byte;
+        if (--parser->argument_bytes > 0) {
+            return RPC_PARSER_NEED_MORE;
+        }
+        return on_header(parser);
+
+    case RPC_PARSER_STATE_STRING:
+        if (parser->text_length < sizeof(parser->text) - 1) {
+            parser->text[parser->text_length++] = (char) byte;
+        }
+        else {
+            parser->text_truncated = true;
+        }
+
+        if (--parser->string_remaining == 0) {
+            end_item(parser);
+        }
+        return RPC_PARSER_NEED_MORE;
+
+    default:
+        return RPC_PARSER_NEED_MORE;
+    }
+}
+
+// Public functions ----------------------------------------------------------------------------------------------------
+
+void rpc_parser_reset(rpc_parser_t *parser)
+{
+    memset(parser, 0, sizeof(*parser));
+}
+
+rpc_parser_event_t rpc_parser_push(rpc_parser_t *parser, uint8_t byte)
+{
+    if (parser->state == RPC_PARSER_STATE_DONE) {
+        return RPC_PARSER_COMPLETE;
+    }
+
+    if (parser->state == RPC_PARSER_STATE_PREFIX) {
+        // 4-byte length prefix (big-endian)
+        parser->message_length = (parser->message_length << 8) | byte;
+        if (++parser->prefix_bytes < 4) {
+            return RPC_PARSER_NEED_MORE;
+        }
+
+        parser->state = parser->message_length > 0 ? RPC_PARSER_STATE_HEADER : RPC_PARSER_STATE_DONE;
+        return RPC_PARSER_LENGTH;
+    }
+
+    parser->offset++;
+    rpc_parser_event_t event = parse_byte(parser, byte);
+
+    if (parser->offset == parser->message_length) {
+        parser->state = RPC_PARSER_STATE_DONE;
+        return RPC_PARSER_COMPLETE;
+    }
+
+    return event;
+}
+
+rpc_parser_event_t rpc_parser_skip(rpc_parser_t *parser, uint32_t length)
+{
+    // Bulk consumption of string contents (or of the rest of a discarded frame) without inspecting the bytes
+    if (parser->state == RPC_PARSER_STATE_STRING) {
+        if (length > parser->string_remaining) {
+            length = parser->string_remaining;
+        }
+
+        parser->string_remaining -= length;
+        parser->offset += length;
+
+        if (parser->string_remaining == 0) {
+            end_item(parser);
+        }
+    }
+    else if (parser->state == RPC_PARSER_STATE_BODY_ONLY) {
+        if (length > rpc_parser_remaining(parser)) {
+            length = rpc_parser_remaining(parser);
+        }
+        parser->offset += length;
+    }
+
+    if (parser->state != RPC_PARSER_STATE_PREFIX && parser->offset == parser->message_length) {
+        parser->state = RPC_PARSER_STATE_DONE;
+        return RPC_PARSER_COMPLETE;
+    }
+
+    return RPC_PARSER_NEED_MORE;
+}
+
+void rpc_parser_discard(rpc_parser_t *parser)
+{
+    if (parser->state != RPC_PARSER_STATE_PREFIX && parser->state != RPC_PARSER_STATE_DONE) {
+        parser->state = RPC_PARSER_STATE_BODY_ONLY;
+    }
+}
+
+uint32_t rpc_parser_remaining(const rpc_parser_t *parser)
+{
+    return parser->message_length - parser->offset;
+}
+
+uint32_t rpc_parser_string_remaining(const rpc_parser_t *parser)
+{
+    return parser->state == RPC_PARSER_STATE_STRING ? parser->string_remaining : 0;
+}
@@ -0,0 +1,77 @@
+#include "text.h"
+#include "image.h"
+#include "log.h"
+
+// Private variables ---------------------------------------------------------------------------------------------------
+
+// Generated with make-font from the DejaVu fonts
+#include "font_mono16.h"
+#include "font_sans24.h"
+
+static const font_t *const fonts[TEXT_FONT_COUNT] = {
+    &font_mono16,
+    &font_sans24,
+};
+
+// Private functions ---------------------------------------------------------------------------------------------------
+
+static const font_glyph_t *text_find_glyph(const font_t *font, char c)
+{
+    uint32_t index = (uint8_t) c - font->first_char;
+
+    if (index >= font->glyph_count) {
+        index = '?' - font->first_char;
+    }
+
+    return &font->glyphs[index];
+}
+
+// Public functions ----------------------------------------------------------------------------------------------------
+
+const font_t *text_get_font(uint32_t font)
+{
+    return font < TEXT_FONT_COUNT ? fonts[font] : NULL;
+}
+
+bool text_draw(uint16_t x, uint16_t y, uint32_t font, uint16_t color, const char *text, size_t length)
+{
+    const font_t *f = text_get_font(font);
+
+    if (f == NULL || x >= IMAGE_WIDTH || y >= IMAGE_HEIGHT || f->height > IMAGE_HEIGHT - y) {
+        return false;
+    }
+
+    // The atlas alpha scales the colour, expanded to ARGB8888 like LTDC does
+    uint32_t argb = GFX_RGB565_TO_ARGB8888(color);
+
+    uint16_t *row = &get_draw_buffer()[y * IMAGE_WIDTH];
+    uint32_t pen = x;
+
+    for (size_t i = 0; i < length; i++) {
+        const font_glyph_t *glyph = text_find_glyph(f, text[i]);
+
+        // A glyph overhanging the left edge of the screen is drawn a little to the right instead
+        int32_t left = (int32_t) pen + glyph->offset;
+        uint32_t cell_x = left < 0 ? 0 : (uint32_t) left;
+
+        if (cell_x + glyph->width > IMAGE_WIDTH) {
+            break;
+        }
+        if (text[i] == ' ') {
+            pen += glyph->advance;
+            continue;
+        }
+
+        // A4 cells start on even columns, so halving gives their first byte
+        const uint8_t *src = f->format == GFX_FORMAT_A4 ? &f->atlas[glyph->x / 2] : &f->atlas[glyph->x];
+        if (!gfx_blend(&row[cell_x], IMAGE_WIDTH, GFX_FORMAT_RGB565, src, f->atlas_width, f->format, glyph->width,
+                       f->height, argb, NULL, NULL)) {
+            LOG_ERROR("Error: Glyph blend rejected\r\n");
+            return false;
+        }
+
+        pen += glyph->advance;
+    }
+
+    return true;
+}
@@ -1,11 +1,25 @@
+import json
+import math
+import re
 import struct
+import time
 from pathlib import Path
 from typing import Optional
 
 import cbor2
 import click
 import serial
-from PIL import Image
+from PIL import Image, ImageDraw, ImageFont
+
+from cbor_host.frame_diff import (
+    FRAME_SIZE,
+    REGION_OVERHEAD,
+    diff_frames,
+    forget_last_frame,
+    load_last_frame,
+    save_last_frame,
+    update_last_frame,
+)
 
 
 def resize_image(image_path: Path, target_width: int = 480, target_height: int = 272) -> Image.Image:
@@ -65,56 +79,417 @@ def convert_to_rgb565(image: Image.Image) -> bytes:
     return b"".join(struct.pack("<H", pixel) for pixel in rgb565_data)
 
 
-def send_rpc_message(rpc_message: dict, host: str, port: int) -> dict:
-    """Send an RPC message to the device and return the response."""
+def convert_to_indexed(image: Image.Image, pixel_format: str) -> tuple:
+    """Quantize a PIL Image for display_indexed.
+
+    Returns the RGB888 palette, the L8 or L4 pixel indices (L4 packs two pixels per byte, the first one in the low
+    nibble) and the quantized image as RGB, which is what the device will show.
+    """
+    colors = 16 if pixel_format == "l4" else 256
+    quantized = image.quantize(colors=colors)
+
+    indices = quantized.tobytes()
+    entries = max(indices) + 1
+    palette = bytes(quantized.getpalette()[: entries * 3])
+
+    if pixel_format == "l4":
+        indices = bytes(indices[i] | (indices[i + 1] << 4) for i in range(0, len(indices), 2))
+
+    return palette, indices, quantized.convert("RGB")
+
+
+def convert_to_argb8888(image: Image.Image) -> bytes:
+    """Convert PIL Image to ARGB8888 format, keeping any transparency."""
+    pixels = image.convert("RGBA").load()
+    width, height = image.size
+
+    # One little-endian 0xAARRGGBB word per pixel
+    return b"".join(
+        struct.pack("<I", (a << 24) | (r << 16) | (g << 8) | b)
+        for y in range(height)
+        for x in range(width)
+        for r, g, b, a in [pixels[x, y]]
+    )
+
+
+def convert_to_argb4444(image: Image.Image) -> bytes:
+    """Convert PIL Image to ARGB4444 format, keeping any transparency."""
+    pixels = image.convert("RGBA").load()
+    width, height = image.size
+
+    return b"".join(
+        struct.pack("<H", (a >> 4) << 12 | (r >> 4) << 8 | (g >> 4) << 4 | b >> 4)
+        for y in range(height)
+        for x in range(width)
+        for r, g, b, a in [pixels[x, y]]
+    )
+
+
+def convert_to_alpha(image: Image.Image, bits: int) -> bytes:
+    """Convert PIL Image to an A8 or A4 alpha mask, from its transparency if it has any, otherwise its brightness.
+
+    A4 packs two pixels per byte, the first one in the low nibble.
+    """
+    if image.mode in ("RGBA", "LA") or "transparency" in image.info:
+        alpha = image.convert("RGBA").getchannel("A")
+    else:
+        alpha = image.convert("L")
+
+    values = alpha.tobytes()
+    if bits == 4:
+        return bytes((values[i] >> 4) | (values[i + 1] >> 4) << 4 for i in range(0, len(values), 2))
+    return values
+
+
+# Buffered messages have to fit the device's message buffer (CBOR_BUFFER_SIZE in comm.h), with 256 bytes kept for the
+# RPC header around a payload
+CBOR_BUFFER_SIZE = 16384
+RPC_HEADER_RESERVE = 256
+
+# Chunked uploads: offsets and lengths are multiples of the device's block size, and each chunk has to fit the
+# message buffer together with its RPC header
+CHUNK_BLOCK_SIZE = 512
+MAX_CHUNK_SIZE = (CBOR_BUFFER_SIZE - RPC_HEADER_RESERVE) // CHUNK_BLOCK_SIZE * CHUNK_BLOCK_SIZE
+CHUNK_MAX_RETRIES = 5
+
+
+def write_rpc_message(ser, rpc_message: dict) -> int:
+    """Write one length-prefixed CBOR message and return the size of its body."""
+    cbor_data = cbor2.dumps(rpc_message)
+
+    # Send length prefix (4 bytes, big-endian) followed by CBOR data
+    length_prefix = struct.pack(">I", len(cbor_data))
+    ser.write(length_prefix + cbor_data)
+
+    return len(cbor_data)
+
+
+def read_rpc_response(ser) -> Optional[dict]:
+    """Read one length-prefixed CBOR response, or return None if it does not arrive before the serial timeout."""
+    # Read 4-byte length prefix
+    length_bytes = ser.read(4)
+    if len(length_bytes) != 4:
+        if length_bytes:
+            raise Exception(f"Expected 4 bytes for length, got {len(length_bytes)}")
+        return None
+
+    # Unpack length (big-endian unsigned int)
+    response_length = struct.unpack(">I", length_bytes)[0]
+
+    # Read the CBOR data
+    response_bytes = ser.read(response_length)
+    if len(response_bytes) != response_length:
+        raise Exception(f"Expected {response_length} bytes, got {len(response_bytes)}")
+
+    # Decode CBOR to get the response
+    return cbor2.loads(response_bytes)
+
+
+def send_image_chunked(ser, image_data: bytes, chunk_size: int = 2048, window: int = 4) -> Optional[dict]:
+    """Upload an image with image_begin/image_chunk/image_commit, keeping up to `window` chunks in flight.
+
+    Chunks are acknowledged by offset. A chunk whose acknowledgement is an error or does not arrive before the serial
+    timeout is resent on its own, and any gap the device reports on commit is filled before committing again.
+    """
+    if chunk_size <= 0 or chunk_size % CHUNK_BLOCK_SIZE != 0 or chunk_size > MAX_CHUNK_SIZE:
+        raise click.BadParameter(f"chunk size must be a multiple of {CHUNK_BLOCK_SIZE} up to {MAX_CHUNK_SIZE}")
+    if window < 1:
+        raise click.BadParameter("window must be at least 1")
+
+    write_rpc_message(ser, {"method": "image_begin", "params": {"size": len(image_data)}})
+    response = read_rpc_response(ser)
+    if not response or response.get("status") != "success":
+        return response
+
+    pending = list(range(0, len(image_data), chunk_size))
+    retries = dict.fromkeys(pending, 0)
+
+    for _ in range(CHUNK_MAX_RETRIES + 1):
+        in_flight = []
+
+        while pending or in_flight:
+            # Keep the window full
+            while pending and len(in_flight) < window:
+                offset = pending.pop(0)
+                chunk = image_data[offset : offset + chunk_size]
+                write_rpc_message(ser, {"method": "image_chunk", "params": {"offset": offset, "data": chunk}})
+                in_flight.append(offset)
+
+            try:
+                ack = read_rpc_response(ser)
+            except Exception:
+                # A corrupted response, drop whatever is left of it and treat it like a lost acknowledgement
+                ser.reset_input_buffer()
+                ack = None
+
+            # The device answers in order, so an acknowledgement without an offset belongs to the oldest chunk
+            offset = ack.get("offset") if ack else None
+            if offset is None:
+                offset = in_flight[0]
+            elif offset not in in_flight:
+                # Late acknowledgement of a chunk that was already resent
+                continue
+            in_flight.remove(offset)
+
+            if ack and ack.get("status") == "success":
+                continue
+
+            retries[offset] += 1
+            if retries[offset] > CHUNK_MAX_RETRIES:
+                raise click.ClickException(f"Chunk at offset {offset} failed after {CHUNK_MAX_RETRIES} retries")
+
+            click.echo(f"⚠ Resending chunk at offset {offset}")
+            pending.insert(0, offset)
+
+        write_rpc_message(ser, {"method": "image_commit", "params": {}})
+        response = read_rpc_response(ser)
+
+        # The device reports the first gap in the upload, resend the chunk that covers it and commit again
+        missing = response.get("offset") if response and response.get("status") != "success" else None
+        if missing is None or not 0 <= missing < len(image_data):
+            return response
+
+        click.echo(f"⚠ Device is missing data at offset {missing}")
+        pending.append(missing - missing % chunk_size)
+        retries.setdefault(pending[-1], 0)
+
+    return response
+
+
+# display_region messages are buffered whole on the device, so their regions, each with the CBOR around its data,
+# have to fit its 16 KB message buffer
+MAX_REGION_PAYLOAD = CBOR_BUFFER_SIZE - RPC_HEADER_RESERVE
+
+
+def region_cost(width: int, height: int) -> int:
+    """Return the most bytes a width x height region can take in a buffered message."""
+    return width * height * 2 + REGION_OVERHEAD
+
+
+def extract_region(frame: bytes, x: int, y: int, width: int, height: int, frame_width: int = 480) -> bytes:
+    """Return the packed RGB565 rows of a rectangle of a full frame."""
+    row_size = width * 2
+    rows = []
+    for row in range(y, y + height):
+        start = (row * frame_width + x) * 2
+        rows.append(frame[start : start + row_size])
+    return b"".join(rows)
+
+
+def build_region_messages(frame: bytes, rectangles: list) -> list:
+    """Pack (x, y, width, height) rectangles of a frame into as few display_region messages as fit the device buffer.
+
+    Rectangles too large for one message are split into bands of whole rows.
+    """
+    messages = []
+    regions = []
+    payload = 0
+
+    for x, y, width, height in rectangles:
+        band_height = max(1, min(height, (MAX_REGION_PAYLOAD - REGION_OVERHEAD) // (width * 2)))
+        for band_y in range(y, y + height, band_height):
+            rows = min(band_height, y + height - band_y)
+            size = region_cost(width, rows)
+            if regions and payload + size > MAX_REGION_PAYLOAD:
+                messages.append({"method": "display_region", "params": {"regions": regions}})
+                regions = []
+                payload = 0
+            data = extract_region(frame, x, band_y, width, rows)
+            regions.append({"x": x, "y": band_y, "width": width, "height": rows, "data": data})
+            payload += size
+
+    if regions:
+        messages.append({"method": "display_region", "params": {"regions": regions}})
+
+    return messages
+
+
+# Streaming sessions: frames in flight at once (STREAM_MAX_CREDITS in comm.h)
+STREAM_MAX_CREDITS = 4
+
+
+def build_stream_frame(seq: int, frame: bytes, last_frame: Optional[bytes]) -> dict:
+    """Build a stream_frame message, holding only the regions that changed since last_frame when they fit in one
+    buffered message and cost less than the whole frame, which otherwise streams straight into the back buffer."""
+    rectangles = diff_frames(last_frame, frame)
+    if rectangles is not None and sum(region_cost(w, h) for _, _, w, h in rectangles) <= MAX_REGION_PAYLOAD:
+        regions = [
+            {"x": x, "y": y, "width": w, "height": h, "data": extract_region(frame, x, y, w, h)}
+            for x, y, w, h in rectangles
+        ]
+        return {"method": "stream_frame", "params": {"seq": seq, "regions": regions}}
+
+    # The pixels go last so the device can stream them
+    return {"method": "stream_frame", "params": {"seq": seq, "image_data": frame}}
+
+
+def stream_frames(
+    ser,
+    frames: list,
+    fps: float,
+    duration: float,
+    credits: int = STREAM_MAX_CREDITS,
+    clock=time.monotonic,
+    sleep=time.sleep,
+) -> Optional[dict]:
+    """Play RGB565 frames to the device at fps for duration seconds in one stream_begin/stream_end session.
+
+    Frame n is due n / fps seconds in, cycling through frames. A frame is only sent while the device has a credit
+    free, and then it is always the newest one due: frames that came due while every credit was in use are skipped
+    here instead of queuing, so latency stays bounded at the credit count. The device shows every frame it receives
+    and each acknowledgement returns exactly one credit, so the window stays at what stream_begin granted. Frames identical to the last one sent are not
+    sent again. Returns the device's session summary with the host's sent and skipped counts added.
+    """
+    write_rpc_message(ser, {"method": "stream_begin", "params": {"credits": credits}})
+    response = read_rpc_response(ser)
+    if not response or response.get("status") != "success":
+        return response
+
+    granted = response.get("credits", 1)
+    available = granted
+    last_frame = None
+    last_number = None
+    seq = 0
+    sent = 0
+    taken = 0
+    start = clock()
+
+    while True:
+        elapsed = clock() - start
+        if elapsed >= duration:
+            break
+        number = int(elapsed * fps)
+
+        if available and number != last_number:
+            frame = frames[number % len(frames)]
+            last_number = number
+            taken += 1
+            if frame != last_frame:
+                seq += 1
+                write_rpc_message(ser, build_stream_frame(seq, frame, last_frame))
+                last_frame = frame
+                available -= 1
+                sent += 1
+            continue
+
+        if available and not ser.in_waiting:
+            # Nothing to read, so idle until the next frame is due
+            sleep(min((number + 1) / fps - elapsed, 0.01))
+            continue
+
+        ack = read_rpc_response(ser)
+        if ack is None:
+            # Acknowledgements lost with their frames, start again from a whole frame
+            click.echo("⚠ Stream acknowledgement timed out, resending a whole frame")
+            available = granted
+            last_frame = None
+            continue
+
+        available = min(granted, available + ack.get("credits", 1))
+        if ack.get("status") != "success":
+            last_frame = None
+
+    # Collect the acknowledgements still outstanding, then close the session
+    while available < granted and read_rpc_response(ser) is not None:
+        available += 1
+
+    write_rpc_message(ser, {"method": "stream_end", "params": {}})
+    summary = read_rpc_response(ser)
+    if summary is None:
+        return None
+
+    summary["sent"] = sent
+    summary["skipped"] = max(0, math.ceil(duration * fps) - taken)
+    return summary
+
+
+# render messages are buffered whole on the device too
+MAX_RENDER_MESSAGE = CBOR_BUFFER_SIZE
+
+
+def build_render_commands(spec: list, base_dir: Path = Path(".")) -> list:
+    """Turn a display list loaded from JSON into render commands.
+
+    Each command is an array starting with its name: ["fill_rect", x, y, width, height, color],
+    ["draw_asset", id, x, y] with an optional ARGB8888 colour, ["copy_region", x, y, width, height, dest_x, dest_y],
+    ["draw_text", x, y, font, color, "text"] or ["region", x, y, width, height, "image.png"], which sends that
+    rectangle of the image cropped and scaled to 480x272. Image paths are relative to base_dir.
+    """
+    commands = []
+    frames = {}
+
+    for command in spec:
+        if not isinstance(command, list) or not command or not isinstance(command[0], str):
+            raise click.BadParameter(f"invalid render command {command!r}")
+
+        if command[0] == "region" and len(command) == 6 and isinstance(command[5], str):
+            x, y, width, height, image = command[1:]
+            path = base_dir / image
+            if path not in frames:
+                frames[path] = convert_to_rgb565(resize_image(path, 480, 272))
+            command = command[:5] + [extract_region(frames[path], x, y, width, height)]
+
+        commands.append(command)
+
+    return commands
+
+
+def echo_response(response: Optional[dict]):
+    """Report a device response to the user."""
+    if response:
+        click.echo(f"✓ Device response: {response}")
+        if response.get("status") == "success":
+            click.echo(f"✓ {response.get('message', 'Operation completed successfully')}")
+        else:
+            click.echo(f"⚠ Device returned: {response.get('message', 'unknown error')}")
+    else:
+        click.echo("✗ No response received from device")
+
+
+def send_rpc_message(
+    rpc_message,
+    host: str,
+    port: int,
+    image_data: Optional[bytes] = None,
+    chunk_size: int = 2048,
+    window: int = 4,
+    timeout: Optional[float] = None,
+) -> dict:
+    """Send an RPC message to the device and return the response.
+
+    rpc_message may also be a list of messages, which are sent in turn over the same connection until one fails.
+    When image_data is given, the image is uploaded in chunks with a sliding window instead and rpc_message is ignored.
+    """
     try:
         # Connect to Renode's virtual serial port via TCP
-        ser = serial.serial_for_url(f"socket://{host}:{port}", timeout=None)
+        ser = serial.serial_for_url(f"socket://{host}:{port}", timeout=timeout)
 
         # Flush any existing data in the buffer
         ser.reset_input_buffer()
         ser.reset_output_buffer()
 
-        # Encode the message as CBOR
-        cbor_data = cbor2.dumps(rpc_message)
-
-        click.echo(f"Sending RPC message ({len(cbor_data)} bytes)")
-
-        # Send length prefix (4 bytes, big-endian) followed by CBOR data
-        length_prefix = struct.pack(">I", len(cbor_data))
-        ser.write(length_prefix + cbor_data)
-
-        # Read response (serial timeout will handle waiting)
-        click.echo("Waiting for device response...")
         try:
-            # Read 4-byte length prefix
-            length_bytes = ser.read(4)
-            if len(length_bytes) != 4:
-                raise Exception(f"Expected 4 bytes for length, got {len(length_bytes)}")
-
-            # Unpack length (big-endian unsigned int)
-            response_length = struct.unpack(">I", length_bytes)[0]
-
-            # Read the CBOR data
-            response_bytes = ser.read(response_length)
-            if len(response_bytes) != response_length:
-                raise Exception(f"Expected {response_length} bytes, got {len(response_bytes)}")
+            if image_data is not None:
+                click.echo(f"Sending image in {chunk_size}-byte chunks, {window} in flight")
+                response = send_image_chunked(ser, image_data, chunk_size, window)
+            else:
+                for message in rpc_message if isinstance(rpc_message, list) else [rpc_message]:
+                    cbor_size = write_rpc_message(ser, message)
+                    click.echo(f"Sending RPC message ({cbor_size} bytes)")
 
-            # Decode CBOR to get the response
-            response = cbor2.loads(response_bytes)
+                    # Read response (serial timeout will handle waiting)
+                    click.echo("Waiting for device response...")
+                    response = read_rpc_response(ser)
+                    if not response or response.get("status") != "success":
+                        break
 
+        except click.ClickException:
+            raise
         except Exception as e:
             click.echo(f"Error reading response: {e}")
             response = None
 
-        if response:
-            click.echo(f"✓ Device response: {response}")
-            if response.get("status") == "success":
-                click.echo(f"✓ {response.get('message', 'Operation completed successfully')}")
-            else:
-                click.echo(f"⚠ Device returned: {response.get('message', 'unknown error')}")
-        else:
-            click.echo("✗ No response received from device")
+        echo_response(response)
 
         return response
 
@@ -170,6 +545,7 @@ def clear(host: str, port: int):
     response = send_rpc_message(rpc_message, host, port)
 
     if response and response.get("status") == "success":
+        save_last_frame(host, port, bytes(FRAME_SIZE))
         click.echo("✓ LCD display cleared successfully!")
     else:
         click.echo("✗ Failed to clear LCD display")
@@ -179,12 +555,37 @@ def clear(host: str, port: int):
 @click.argument("image_path", type=click.Path(exists=True, path_type=Path), required=False)
 @click.option("--host", default="localhost", help="Renode host address")
 @click.option("--port", default=3456, help="Renode USART6 TCP port")
-def display(image_path: Optional[Path], host: str, port: int):
+@click.option("--chunked", is_flag=True, help="Upload the image in acknowledged chunks instead of one message")
+@click.option("--chunk-size", default=2048, help=f"Chunk size in bytes, a multiple of {CHUNK_BLOCK_SIZE}")
+@click.option("--window", default=4, help="Number of chunks in flight")
+@click.option("--timeout", default=2.0, help="Seconds to wait for a chunk acknowledgement")
+@click.option("--full", is_flag=True, help="Send the whole frame even if only part of it changed since the last one")
+@click.option(
+    "--format",
+    "pixel_format",
+    type=click.Choice(["rgb565", "l8", "l4"]),
+    default="rgb565",
+    help="Pixel format of a whole frame: RGB565, or 256/16-colour palettized L8/L4",
+)
+def display(
+    image_path: Optional[Path],
+    host: str,
+    port: int,
+    chunked: bool,
+    chunk_size: int,
+    window: int,
+    timeout: float,
+    full: bool,
+    pixel_format: str,
+):
     """Display an image on the LCD screen
 
     IMAGE_PATH: Path to the image file to send to the device (optional)
 
     If IMAGE_PATH is omitted, the default image will be displayed.
+
+    The last frame sent to each device is remembered, and only the rectangles that changed since then are sent unless
+    the whole frame is cheaper or they do not fit one message. Use --full after the device has been reset.
     """
     click.echo(f"Connecting to {host}:{port}")
 
@@ -194,6 +595,9 @@ def display(image_path: Optional[Path], host: str, port: int):
         rpc_message = {"method": "display_default", "params": {}}
         response = send_rpc_message(rpc_message, host, port)
 
+        # The default image is compiled into the firmware, so the next update sends a whole frame
+        forget_last_frame(host, port)
+
         if response and response.get("status") == "success":
             click.echo("✓ Default image displayed successfully!")
         else:
@@ -208,55 +612,1215 @@ def display(image_path: Optional[Path], host: str, port: int):
             resized_image = resize_image(image_path, 480, 272)
             click.echo("✓ Image processed (cropped and scaled to 480x272)")
 
-            # Convert to RGB565
-            rgb565_data = convert_to_rgb565(resized_image)
-            click.echo(f"✓ Image converted to RGB565 ({len(rgb565_data)} bytes)")
+            if pixel_format == "rgb565":
+                # Convert to RGB565
+                rgb565_data = convert_to_rgb565(resized_image)
+                click.echo(f"✓ Image converted to RGB565 ({len(rgb565_data)} bytes)")
+
+                # Create CBOR-RPC message with image data
+                rpc_message = {"method": "display_image", "params": {"image_data": rgb565_data}}
+            else:
+                # Palettize, the pixels go last so the device can stream them
+                palette, pixels, quantized_image = convert_to_indexed(resized_image, pixel_format)
+                rgb565_data = convert_to_rgb565(quantized_image)
+                click.echo(
+                    f"✓ Image converted to {pixel_format.upper()} ({len(pixels)} bytes, {len(palette) // 3} colours)"
+                )
+
+                rpc_message = {"method": "display_indexed", "params": {"palette": palette, "pixels": pixels}}
 
         except Exception as e:
             click.echo(f"Error processing image: {e}", err=True)
             return
 
-        # Create CBOR-RPC message with image data
-        rpc_message = {"method": "display_image", "params": {"image_data": rgb565_data}}
+        if chunked and pixel_format != "rgb565":
+            raise click.BadParameter("--chunked only supports the rgb565 format")
+
+        # Compare against the last frame sent to this device
+        full_size = len(cbor2.dumps(rpc_message))
+        rectangles = None if full else diff_frames(load_last_frame(host, port), rgb565_data, full_size)
+        if rectangles == []:
+            click.echo("✓ Image unchanged since the last update, nothing to send")
+            return
+
+        # Each display_region request shows a frame of its own, so a diff spread over several would appear in steps
+        region_messages = build_region_messages(rgb565_data, rectangles) if rectangles is not None else None
+        if region_messages is not None and len(region_messages) > 1:
+            click.echo("Changed regions do not fit one message, sending the whole frame")
+            region_messages = None
 
         click.echo("Connected to device. Sending image data...")
-        response = send_rpc_message(rpc_message, host, port)
+        if region_messages is not None:
+            changed = sum(width * height * 2 for _, _, width, height in rectangles)
+            click.echo(f"Sending {len(rectangles)} changed regions ({changed} of {len(rgb565_data)} bytes)")
+            response = send_rpc_message(region_messages[0], host, port)
+        elif chunked:
+            response = send_rpc_message(
+                rpc_message, host, port, image_data=rgb565_data, chunk_size=chunk_size, window=window, timeout=timeout
+            )
+        else:
+            response = send_rpc_message(rpc_message, host, port)
 
         if response and response.get("status") == "success":
+            save_last_frame(host, port, rgb565_data)
             click.echo("✓ Image sent successfully!")
         else:
+            # The device may hold a partial update now
+            forget_last_frame(host, port)
             click.echo("✗ Failed to send image")
 
 
 @cli.command()
-@click.option("-i", "--input", type=click.Path(exists=True, path_type=Path), required=True)
-@click.option("-o", "--output", type=click.Path(), required=True, help="Output C header file")
-@click.option("--columns", default=14, help="Number of values per line")
-def make_header(input: Path, output: Path, columns: int):
-    """Convert PNG image to C header file with RGB565 data."""
-    # Resize and crop image to 480x272 using the shared logic
-    processed_image = resize_image(input, 480, 272)
+@click.argument("image_paths", type=click.Path(exists=True, path_type=Path), nargs=-1, required=True)
+@click.option("--fps", type=click.FloatRange(min=0, min_open=True), default=30.0, help="Frames per second")
+@click.option("--duration", type=click.FloatRange(min=0, min_open=True), default=10.0, help="Seconds to stream for")
+@click.option(
+    "--credits",
+    type=click.IntRange(1, STREAM_MAX_CREDITS),
+    default=STREAM_MAX_CREDITS,
+    help="Frames in flight, fewer keeps latency lower",
+)
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def stream(image_paths: tuple, fps: float, duration: float, credits: int, host: str, port: int):
+    """Stream images to the device as video over one connection, skipping frames the link cannot keep up with
 
-    # Convert to RGB565
-    rgb565_data = convert_to_rgb565(processed_image)
+    IMAGE_PATHS: Frames in playing order, cropped and scaled to 480x272 like display and cycled for the duration
+    """
+    click.echo(f"CBOR Host - Streaming {len(image_paths)} frames at {fps:g} fps for {duration:g} s")
 
-    # Convert RGB565 bytes to 16-bit values
-    values = [struct.unpack("<H", rgb565_data[i : i + 2])[0] for i in range(0, len(rgb565_data), 2)]
+    frames = [convert_to_rgb565(resize_image(path, 480, 272)) for path in image_paths]
 
-    with open(output, "w") as f:
-        # Write header
-        f.write("// Generated automatically - do not edit\n")
+    click.echo(f"Connecting to {host}:{port}")
+    ser = serial.serial_for_url(f"socket://{host}:{port}", timeout=2.0)
+    try:
+        ser.reset_input_buffer()
+        summary = stream_frames(ser, frames, fps, duration, credits)
+    finally:
+        ser.close()
 
-        # Generate values suitable for a C array
-        for i, val in enumerate(values):
-            f.write(f"0x{val:04X}")
-            if (i + 1) % columns == 0:
-                f.write(",\n")
-            else:
-                f.write(", ")
+    # Which frame ended up on screen depends on timing, so the next update sends a whole frame
+    forget_last_frame(host, port)
 
-        # Ensure we end with a newline if the last line wasn't complete
-        if len(values) % columns != 0:
-            f.write("\n")
+    if not summary or summary.get("status") != "success":
+        echo_response(summary)
+        click.echo("✗ Stream failed")
+        return
 
-    click.echo(f"Generated {output} with {len(values)} uint16_t values (480x272 RGB565)")
+    click.echo(f"✓ Sent {summary['sent']} frames, skipped {summary['skipped']} the link could not carry in time")
+    click.echo(f"✓ Device showed {summary.get('frames', 0)} frames at {summary.get('fps', 0.0):.1f} fps")
+
+
+@cli.command()
+@click.argument("image_path", type=click.Path(exists=True, path_type=Path), required=True)
+@click.option("--x", "x", default=0, help="Left edge of the region in pixels")
+@click.option("--y", "y", default=0, help="Top edge of the region in pixels")
+@click.option("--width", default=480, help="Region width in pixels")
+@click.option("--height", default=272, help="Region height in pixels")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def region(image_path: Path, x: int, y: int, width: int, height: int, host: str, port: int):
+    """Update one rectangle of the LCD screen from an image
+
+    IMAGE_PATH: Path to the image file, cropped and scaled to 480x272 like display
+    """
+    if width <= 0 or height <= 0 or x < 0 or y < 0 or x + width > 480 or y + height > 272:
+        raise click.BadParameter("region must lie within the 480x272 screen")
+
+    click.echo(f"CBOR Host - Updating {width}x{height} region at ({x}, {y}) from {image_path}")
+
+    frame = convert_to_rgb565(resize_image(image_path, 480, 272))
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(build_region_messages(frame, [(x, y, width, height)]), host, port)
+
+    # Keep the remembered frame in step with the device
+    if not response or response.get("status") != "success":
+        forget_last_frame(host, port)
+        click.echo("✗ Failed to update region")
+        return
+
+    update_last_frame(host, port, x, y, width, height, extract_region(frame, x, y, width, height))
+    click.echo("✓ Region updated successfully!")
+
+
+def parse_color(ctx, param, value: Optional[str]) -> Optional[int]:
+    """Parse an RGB565 colour given in decimal or with a 0x prefix."""
+    if value is None:
+        return None
+    try:
+        color = int(value, 0)
+    except ValueError:
+        raise click.BadParameter("colour must be a number, e.g. 0xF800 for red") from None
+    if not 0 <= color <= 0xFFFF:
+        raise click.BadParameter("colour must be a 16-bit RGB565 value")
+    return color
+
+
+@cli.command()
+@click.option("--x", "x", default=0, help="Left edge of the rectangle in pixels")
+@click.option("--y", "y", default=0, help="Top edge of the rectangle in pixels")
+@click.option("--width", default=480, help="Rectangle width in pixels")
+@click.option("--height", default=272, help="Rectangle height in pixels")
+@click.option("--color", default="0x0000", callback=parse_color, help="RGB565 colour, e.g. 0xF800 for red")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def fill(x: int, y: int, width: int, height: int, color: int, host: str, port: int):
+    """Fill a rectangle of the LCD screen with a solid colour"""
+    if width <= 0 or height <= 0 or x < 0 or y < 0 or x + width > 480 or y + height > 272:
+        raise click.BadParameter("rectangle must lie within the 480x272 screen")
+
+    click.echo(f"CBOR Host - Filling {width}x{height} rectangle at ({x}, {y}) with 0x{color:04X}")
+
+    rpc_message = {
+        "method": "fill_rect",
+        "params": {"x": x, "y": y, "width": width, "height": height, "color": color},
+    }
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    if not response or response.get("status") != "success":
+        forget_last_frame(host, port)
+        click.echo("✗ Failed to fill rectangle")
+        return
+
+    update_last_frame(host, port, x, y, width, height, struct.pack("<H", color) * (width * height))
+    click.echo("✓ Rectangle filled successfully!")
+
+
+# Fonts compiled into the device, the index is the font ID (fonts[] in text.c)
+TEXT_FONTS = ["mono16", "sans24"]
+
+
+@cli.command()
+@click.argument("text", type=str, required=True)
+@click.option("--x", "x", default=0, help="Left edge of the text in pixels")
+@click.option("--y", "y", default=0, help="Top edge of the text in pixels")
+@click.option("--font", type=click.Choice(TEXT_FONTS), default=TEXT_FONTS[0], help="Font to draw with")
+@click.option("--color", default="0xFFFF", callback=parse_color, help="RGB565 colour, e.g. 0xF800 for red")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def text(text: str, x: int, y: int, font: str, color: int, host: str, port: int):
+    """Draw a line of text with one of the device's built-in fonts
+
+    TEXT: Printable ASCII, anything else is drawn as '?' and the line is cut off at the right edge of the screen
+    """
+    if not 0 <= x < 480 or not 0 <= y < 272:
+        raise click.BadParameter("text must start on the 480x272 screen")
+
+    click.echo(f"CBOR Host - Drawing {text!r} at ({x}, {y}) in {font}")
+
+    rpc_message = {
+        "method": "draw_text",
+        "params": {"x": x, "y": y, "font": TEXT_FONTS.index(font), "color": color, "text": text},
+    }
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    # The glyphs cannot be reproduced here, so the next update sends a whole frame
+    forget_last_frame(host, port)
+
+    if response and response.get("status") == "success":
+        click.echo("✓ Text drawn successfully!")
+    else:
+        click.echo("✗ Failed to draw text")
+
+
+@cli.command()
+@click.argument("list_path", type=click.Path(exists=True, path_type=Path), required=True)
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def render(list_path: Path, host: str, port: int):
+    """Draw a display list in one request, shown as a single frame
+
+    LIST_PATH: JSON file holding an array of commands, e.g. [["fill_rect", 0, 0, 480, 40, 31], ["draw_asset", 1, 8, 4]]
+    """
+    try:
+        spec = json.loads(list_path.read_text())
+    except ValueError as e:
+        raise click.BadParameter(f"invalid JSON: {e}") from None
+    if not isinstance(spec, list):
+        raise click.BadParameter("the display list must be a JSON array")
+
+    rpc_message = {"method": "render", "params": {"commands": build_render_commands(spec, list_path.parent)}}
+    if len(cbor2.dumps(rpc_message)) > MAX_RENDER_MESSAGE - 4:
+        raise click.BadParameter(f"the display list must encode to less than {MAX_RENDER_MESSAGE} bytes")
+
+    click.echo(f"CBOR Host - Rendering {len(spec)} commands from {list_path}")
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    # Assets and copies cannot be reproduced here, so the next update sends a whole frame
+    forget_last_frame(host, port)
+
+    if response and response.get("status") == "success":
+        click.echo("✓ Display list rendered successfully!")
+    else:
+        click.echo("✗ Failed to render display list")
+
+
+@cli.group()
+def overlay():
+    """Control the overlay drawn by LTDC on top of the displayed image"""
+    pass
+
+
+@overlay.command("upload")
+@click.argument("image_path", type=click.Path(exists=True, path_type=Path), required=True)
+@click.option("--x", "x", default=0, help="Left edge of the overlay in pixels")
+@click.option("--y", "y", default=0, help="Top edge of the overlay in pixels")
+@click.option("--width", type=int, help="Overlay width in pixels, the image's own width by default")
+@click.option("--height", type=int, help="Overlay height in pixels, the image's own height by default")
+@click.option(
+    "--format",
+    "pixel_format",
+    type=click.Choice(["rgb565", "argb8888"]),
+    default="rgb565",
+    help="Pixel format: RGB565, or ARGB8888 to keep the image's transparency",
+)
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def overlay_upload(
+    image_path: Path,
+    x: int,
+    y: int,
+    width: Optional[int],
+    height: Optional[int],
+    pixel_format: str,
+    host: str,
+    port: int,
+):
+    """Show an image in the overlay
+
+    IMAGE_PATH: Path to the image file, scaled to --width and --height if given
+    """
+    with Image.open(image_path) as img:
+        image = img.convert("RGBA")
+    width = width or image.width
+    height = height or image.height
+    if width <= 0 or height <= 0 or x < 0 or y < 0 or x + width > 480 or y + height > 272:
+        raise click.BadParameter("overlay must lie within the 480x272 screen")
+
+    if image.size != (width, height):
+        image = image.resize((width, height), Image.Resampling.LANCZOS)
+
+    if pixel_format == "argb8888":
+        pixels = convert_to_argb8888(image)
+    else:
+        pixels = convert_to_rgb565(image.convert("RGB"))
+
+    click.echo(f"CBOR Host - Uploading {width}x{height} {pixel_format.upper()} overlay at ({x}, {y})")
+
+    # The pixels go last so the device can stream them
+    rpc_message = {
+        "method": "overlay_upload",
+        "params": {"x": x, "y": y, "width": width, "height": height, "format": pixel_format, "pixels": pixels},
+    }
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    if response and response.get("status") == "success":
+        click.echo("✓ Overlay uploaded successfully!")
+    else:
+        click.echo("✗ Failed to upload overlay")
+
+
+@overlay.command("move")
+@click.option("--x", "x", required=True, type=int, help="New left edge of the overlay in pixels")
+@click.option("--y", "y", required=True, type=int, help="New top edge of the overlay in pixels")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def overlay_move(x: int, y: int, host: str, port: int):
+    """Move the overlay without resending it"""
+    if x < 0 or y < 0:
+        raise click.BadParameter("position must lie within the 480x272 screen")
+
+    rpc_message = {"method": "overlay_move", "params": {"x": x, "y": y}}
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    if response and response.get("status") == "success":
+        click.echo(f"✓ Overlay moved to ({x}, {y})")
+    else:
+        click.echo("✗ Failed to move overlay")
+
+
+@overlay.command("alpha")
+@click.argument("alpha", type=click.IntRange(0, 255))
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def overlay_alpha(alpha: int, host: str, port: int):
+    """Set the overlay's constant alpha
+
+    ALPHA: 0 (hidden) to 255 (opaque), multiplied with any per-pixel alpha
+    """
+    rpc_message = {"method": "overlay_alpha", "params": {"alpha": alpha}}
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    if response and response.get("status") == "success":
+        click.echo(f"✓ Overlay alpha set to {alpha}")
+    else:
+        click.echo("✗ Failed to set overlay alpha")
+
+
+@overlay.command("key")
+@click.option("--color", callback=parse_color, help="RGB565 colour drawn as transparent, e.g. 0xF81F")
+@click.option("--off", is_flag=True, help="Turn the colour key off")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def overlay_key(color: Optional[int], off: bool, host: str, port: int):
+    """Make one overlay colour transparent"""
+    if off == (color is not None):
+        raise click.BadParameter("give either --color or --off")
+
+    params = {"enabled": False} if off else {"enabled": True, "color": color}
+    rpc_message = {"method": "overlay_color_key", "params": params}
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    if response and response.get("status") == "success":
+        click.echo("✓ Overlay colour key updated")
+    else:
+        click.echo("✗ Failed to update overlay colour key")
+
+
+# Asset IDs and formats the device's asset cache accepts (asset.h)
+ASSET_MAX_COUNT = 64
+ASSET_FORMATS = ["rgb565", "argb8888", "argb4444", "a8", "a4"]
+
+
+def convert_asset(image: Image.Image, pixel_format: str) -> bytes:
+    """Convert a PIL Image to one of the asset formats."""
+    if pixel_format == "argb8888":
+        return convert_to_argb8888(image)
+    if pixel_format == "argb4444":
+        return convert_to_argb4444(image)
+    if pixel_format in ("a8", "a4"):
+        return convert_to_alpha(image, 8 if pixel_format == "a8" else 4)
+    return convert_to_rgb565(image.convert("RGB"))
+
+
+@cli.group()
+def asset():
+    """Upload images to the device once and draw them by ID"""
+    pass
+
+
+@asset.command("upload")
+@click.argument("image_path", type=click.Path(exists=True, path_type=Path), required=True)
+@click.option("--id", "asset_id", type=click.IntRange(0, ASSET_MAX_COUNT - 1), required=True, help="Asset ID")
+@click.option("--width", type=int, help="Asset width in pixels, the image's own width by default")
+@click.option("--height", type=int, help="Asset height in pixels, the image's own height by default")
+@click.option(
+    "--format",
+    "pixel_format",
+    type=click.Choice(ASSET_FORMATS),
+    default="rgb565",
+    help="Pixel format: opaque RGB565, ARGB8888/ARGB4444 with transparency, or an A8/A4 mask drawn in one colour",
+)
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def asset_upload(
+    image_path: Path,
+    asset_id: int,
+    width: Optional[int],
+    height: Optional[int],
+    pixel_format: str,
+    host: str,
+    port: int,
+):
+    """Store an image in the device's asset cache
+
+    IMAGE_PATH: Path to the image file, scaled to --width and --height if given
+    """
+    with Image.open(image_path) as img:
+        image = img.convert("RGBA")
+    width = width or image.width
+    height = height or image.height
+    if width <= 0 or height <= 0 or width > 480 or height > 272:
+        raise click.BadParameter("asset must fit the 480x272 screen")
+    if pixel_format == "a4" and width % 2 != 0:
+        raise click.BadParameter("a4 assets need an even width")
+
+    if image.size != (width, height):
+        image = image.resize((width, height), Image.Resampling.LANCZOS)
+
+    pixels = convert_asset(image, pixel_format)
+
+    click.echo(f"CBOR Host - Uploading {width}x{height} {pixel_format.upper()} asset {asset_id} ({len(pixels)} bytes)")
+
+    # The pixels go last so the device can stream them
+    rpc_message = {
+        "method": "asset_upload",
+        "params": {"id": asset_id, "width": width, "height": height, "format": pixel_format, "pixels": pixels},
+    }
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    if response and response.get("status") == "success":
+        click.echo(f"✓ Asset {asset_id} uploaded successfully!")
+    else:
+        click.echo(f"✗ Failed to upload asset {asset_id}")
+
+
+@asset.command("draw")
+@click.option("--id", "asset_id", type=click.IntRange(0, ASSET_MAX_COUNT - 1), required=True, help="Asset ID")
+@click.option("--x", "x", default=0, help="Left edge in pixels")
+@click.option("--y", "y", default=0, help="Top edge in pixels")
+@click.option("--color", help="ARGB8888 colour for A8/A4 assets, its alpha fades any blended asset, e.g. 0xFFFF0000")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def asset_draw(asset_id: int, x: int, y: int, color: Optional[str], host: str, port: int):
+    """Draw an uploaded asset on the LCD screen"""
+    params = {"id": asset_id, "x": x, "y": y}
+    if color is not None:
+        try:
+            params["color"] = int(color, 0)
+        except ValueError:
+            raise click.BadParameter("colour must be a number, e.g. 0xFFFF0000 for red") from None
+        if not 0 <= params["color"] <= 0xFFFFFFFF:
+            raise click.BadParameter("colour must be a 32-bit ARGB8888 value")
+
+    rpc_message = {"method": "draw_asset", "params": params}
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    # The host cannot reproduce the blend, so the next update sends a whole frame
+    forget_last_frame(host, port)
+
+    if response and response.get("status") == "success":
+        click.echo(f"✓ Asset {asset_id} drawn at ({x}, {y})")
+    else:
+        click.echo(f"✗ Failed to draw asset {asset_id}")
+
+
+@asset.command("clear")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def asset_clear(host: str, port: int):
+    """Remove every asset from the device"""
+    rpc_message = {"method": "asset_clear", "params": {}}
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    if response and response.get("status") == "success":
+        click.echo("✓ Assets cleared successfully!")
+    else:
+        click.echo("✗ Failed to clear assets")
+
+
+# Scrolling plots on the device (PLOT_MAX_COUNT and PLOT_MAX_SAMPLES in plot.h)
+PLOT_MAX_COUNT = 8
+PLOT_MAX_SAMPLES = 480
+
+
+@cli.group()
+def plot():
+    """Scrolling time-series plots drawn by the device"""
+
+
+@plot.command("create")
+@click.option("--id", "plot_id", type=click.IntRange(0, PLOT_MAX_COUNT - 1), required=True, help="Plot ID")
+@click.option("--x", "x", default=0, help="Left edge of the plot in pixels")
+@click.option("--y", "y", default=0, help="Top edge of the plot in pixels")
+@click.option("--width", default=480, help="Plot width in pixels, one sample per column")
+@click.option("--height", default=100, help="Plot height in pixels")
+@click.option("--min", "minimum", default=0, help="Sample value on the bottom row")
+@click.option("--max", "maximum", default=100, help="Sample value on the top row")
+@click.option("--color", default="0x07E0", callback=parse_color, help="RGB565 line colour, e.g. 0x07E0 for green")
+@click.option("--background", default="0x0000", callback=parse_color, help="RGB565 background colour")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def plot_create(
+    plot_id: int,
+    x: int,
+    y: int,
+    width: int,
+    height: int,
+    minimum: int,
+    maximum: int,
+    color: int,
+    background: int,
+    host: str,
+    port: int,
+):
+    """Clear a rectangle of the screen and set it up as a plot"""
+    if width <= 0 or height <= 0 or x < 0 or y < 0 or x + width > 480 or y + height > 272:
+        raise click.BadParameter("plot must lie within the 480x272 screen")
+    if minimum >= maximum:
+        raise click.BadParameter("--min must be less than --max")
+
+    click.echo(f"CBOR Host - Creating plot {plot_id}: {width}x{height} at ({x}, {y}), {minimum} to {maximum}")
+
+    rpc_message = {
+        "method": "plot_create",
+        "params": {
+            "id": plot_id,
+            "x": x,
+            "y": y,
+            "width": width,
+            "height": height,
+            "min": minimum,
+            "max": maximum,
+            "color": color,
+            "background": background,
+        },
+    }
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    # The plot is drawn by the device from here on, so the next update sends a whole frame
+    forget_last_frame(host, port)
+
+    if response and response.get("status") == "success":
+        click.echo(f"✓ Plot {plot_id} created successfully!")
+    else:
+        click.echo(f"✗ Failed to create plot {plot_id}")
+
+
+@plot.command("append")
+@click.argument("samples", type=int, nargs=-1, required=True)
+@click.option("--id", "plot_id", type=click.IntRange(0, PLOT_MAX_COUNT - 1), required=True, help="Plot ID")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def plot_append(samples: tuple, plot_id: int, host: str, port: int):
+    """Scroll a plot left and draw new samples on its right
+
+    SAMPLES: Integer sample values, oldest first (use -- before the first one if it is negative)
+    """
+    if len(samples) > PLOT_MAX_SAMPLES:
+        raise click.BadParameter(f"at most {PLOT_MAX_SAMPLES} samples can be appended at once")
+
+    rpc_message = {"method": "plot_append", "params": {"id": plot_id, "samples": list(samples)}}
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    forget_last_frame(host, port)
+
+    if response and response.get("status") == "success":
+        click.echo(f"✓ {len(samples)} samples appended to plot {plot_id}")
+    else:
+        click.echo(f"✗ Failed to append to plot {plot_id}")
+
+
+# Full-screen image slots preloaded into the device's SDRAM (IMAGE_SLOT_COUNT in image.h)
+SLOT_COUNT = 24
+
+
+@cli.command()
+@click.argument("image_path", type=click.Path(exists=True, path_type=Path), required=True)
+@click.option("--slot", type=click.IntRange(0, SLOT_COUNT - 1), required=True, help="Slot to store the image in")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def store(image_path: Path, slot: int, host: str, port: int):
+    """Preload an image into a slot on the device without displaying it
+
+    IMAGE_PATH: Path to the image file, cropped and scaled to 480x272 like display
+    """
+    click.echo(f"CBOR Host - Storing {image_path} in slot {slot}")
+
+    rgb565_data = convert_to_rgb565(resize_image(image_path, 480, 272))
+
+    # The image data goes last so the device can stream it into the slot
+    rpc_message = {"method": "store_image", "params": {"slot": slot, "image_data": rgb565_data}}
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    if response and response.get("status") == "success":
+        click.echo(f"✓ Image stored in slot {slot}")
+    else:
+        click.echo("✗ Failed to store image")
+
+
+@cli.command()
+@click.option("--slot", type=click.IntRange(0, SLOT_COUNT - 1), required=True, help="Slot to display")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def show(slot: int, host: str, port: int):
+    """Display an image preloaded with store, switching at the next frame"""
+    click.echo(f"CBOR Host - Showing slot {slot}")
+
+    rpc_message = {"method": "show_slot", "params": {"slot": slot}}
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    # The slot's contents are not remembered here, so the next update sends a whole frame
+    forget_last_frame(host, port)
+
+    if response and response.get("status") == "success":
+        click.echo(f"✓ Slot {slot} displayed successfully!")
+    else:
+        click.echo(f"✗ Failed to display slot {slot}")
+
+
+# Animation playback from slots (PLAYBACK_MAX_FRAMES and PLAYBACK_MAX_FPS in playback.h)
+PLAYBACK_MAX_FRAMES = 64
+PLAYBACK_MAX_FPS = 60
+
+
+@cli.command()
+@click.argument("slots", type=click.IntRange(0, SLOT_COUNT - 1), nargs=-1, required=True)
+@click.option("--fps", type=click.IntRange(1, PLAYBACK_MAX_FPS), default=12, help="Frames per second")
+@click.option("--once", is_flag=True, help="Stop on the last frame instead of looping")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def play(slots: tuple, fps: int, once: bool, host: str, port: int):
+    """Play an animation from slots preloaded with store, timed by the device
+
+    SLOTS: Slots in playing order, a slot can appear more than once
+    """
+    if len(slots) > PLAYBACK_MAX_FRAMES:
+        raise click.BadParameter(f"a sequence has at most {PLAYBACK_MAX_FRAMES} frames")
+
+    click.echo(f"CBOR Host - Playing {len(slots)} frames at {fps} fps{'' if once else ', looped'}")
+
+    rpc_message = {"method": "play", "params": {"sequence": list(slots), "fps": fps, "loop": not once}}
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    # The frame left on screen is not known here, so the next update sends a whole frame
+    forget_last_frame(host, port)
+
+    if response and response.get("status") == "success":
+        click.echo("✓ Playback started")
+    else:
+        click.echo("✗ Failed to start playback")
+
+
+@cli.command()
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def play_stop(host: str, port: int):
+    """Stop an animation, leaving its current frame on screen"""
+    rpc_message = {"method": "play_stop", "params": {}}
+
+    click.echo(f"Connecting to {host}:{port}")
+    response = send_rpc_message(rpc_message, host, port)
+
+    if response and response.get("status") == "success":
+        click.echo("✓ Playback stopped")
+    else:
+        click.echo("✗ Failed to stop playback")
+
+
+def read_profile(ser, reset: bool = False) -> list:
+    """Read every stage's histogram with get_profile, which returns one stage per request, and clear them if asked.
+
+    Returns the responses in stage order, stopping at the first one that fails.
+    """
+    stages = []
+    count = 1  # Until the first response says how many there are
+    while len(stages) < count:
+        write_rpc_message(ser, {"method": "get_profile", "params": {"stage": len(stages)}})
+        response = read_rpc_response(ser)
+        stages.append(response)
+        if not response or response.get("status") != "success":
+            return stages
+        count = response.get("stages", 0)
+
+    if reset:
+        write_rpc_message(ser, {"method": "get_profile", "params": {"stage": 0, "reset": True}})
+        read_rpc_response(ser)
+
+    return stages
+
+
+def bucket_percentile(buckets: list, fraction: float) -> int:
+    """Return the upper bound in cycles of the log2 bucket holding the given fraction of the samples."""
+    target = fraction * sum(buckets)
+    seen = 0
+    for index, count in enumerate(buckets):
+        seen += count
+        if count and seen >= target:
+            return (2 << index) - 1
+    return 0
+
+
+@cli.command()
+@click.option("--reset", is_flag=True, help="Clear the histograms after reading them")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def profile(reset: bool, host: str, port: int):
+    """Show how long each stage of the device's message pipeline takes, from its cycle counter"""
+    click.echo(f"Connecting to {host}:{port}")
+    ser = serial.serial_for_url(f"socket://{host}:{port}", timeout=2.0)
+    try:
+        ser.reset_input_buffer()
+        stages = read_profile(ser, reset)
+    finally:
+        ser.close()
+
+    if not stages or not stages[-1] or stages[-1].get("status") != "success":
+        echo_response(stages[-1] if stages else None)
+        click.echo("✗ Failed to read the profile")
+        return
+
+    # Percentiles come from log2 buckets, so they are upper bounds within a factor of two
+    headings = ["Min µs", "Mean µs", "P50 ≤ µs", "P99 ≤ µs", "Max µs"]
+    click.echo(f"{'Stage':<10} {'Count':>8}" + "".join(f" {heading:>10}" for heading in headings))
+    for stage in stages:
+        cycles_per_us = stage["clock"] / 1e6
+        count = stage["count"]
+        mean = stage["total"] / count if count else 0
+        values = [stage["min"], mean, bucket_percentile(stage["buckets"], 0.5)]
+        values += [bucket_percentile(stage["buckets"], 0.99), stage["max"]]
+        click.echo(f"{stage['stage']:<10} {count:>8}" + "".join(f" {value / cycles_per_us:>10.1f}" for value in values))
+
+    if reset:
+        click.echo("✓ Profile cleared")
+
+
+def read_stats(ser) -> tuple:
+    """Read the device's counters and then its method call counts, which get_stats returns a page at a time.
+
+    Returns (stats, calls), where calls holds (method, streamed, count) per method, or (response, None) on failure.
+    """
+    write_rpc_message(ser, {"method": "get_stats", "params": {}})
+    stats = read_rpc_response(ser)
+    if not stats or stats.get("status") != "success":
+        return stats, None
+
+    calls = []
+    while len(calls) < stats["methods"]:
+        write_rpc_message(ser, {"method": "get_stats", "params": {"first": len(calls)}})
+        page = read_rpc_response(ser)
+        if not page or page.get("status") != "success" or not page["calls"]:
+            return page, None
+        calls += [tuple(entry) for entry in page["calls"]]
+
+    return stats, calls
+
+
+@cli.command()
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def stats(host: str, port: int):
+    """Show the device's transport and pipeline counters since boot"""
+    click.echo(f"Connecting to {host}:{port}")
+    ser = serial.serial_for_url(f"socket://{host}:{port}", timeout=2.0)
+    try:
+        ser.reset_input_buffer()
+        counters, calls = read_stats(ser)
+    finally:
+        ser.close()
+
+    if calls is None:
+        echo_response(counters)
+        click.echo("✗ Failed to read the stats")
+        return
+
+    peak = 100 * counters["ring_peak"] / counters["ring_size"]
+    click.echo(f"Received {counters['rx_bytes']} bytes in {counters['rx_frames']} frames")
+    click.echo(f"Sent {counters['tx_bytes']} bytes in {counters['tx_frames']} frames")
+    click.echo(f"Receive ring peak {counters['ring_peak']} of {counters['ring_size']} bytes ({peak:.0f}%)")
+
+    errors = {
+        "UART overrun errors": counters["overrun_errors"],
+        "UART framing errors": counters["framing_errors"],
+        "UART noise errors": counters["noise_errors"],
+        "Receive ring overflows": counters["ring_overflows"],
+        "Oversize messages": counters["oversize_messages"],
+        "Resyncs": counters["resyncs"],
+        "CBOR parse errors": counters["parse_errors"],
+        "Log messages dropped": counters["log_dropped"],
+    }
+    for name, count in errors.items():
+        click.echo(f"{'⚠' if count else '✓'} {name}: {count}")
+
+    click.echo("Method calls:")
+    for method, streamed, count in calls:
+        if count:
+            click.echo(f"  {method + (' (streamed)' if streamed else ''):<28} {count:>8}")
+
+
+# An unfinished message is dropped once the line has been quiet this long (USART6_RESYNC_IDLE_MS in comm.h)
+RESYNC_IDLE_MS = 100
+
+
+def check_idle_resync(ser, sleep=time.sleep) -> Optional[dict]:
+    """Send the first half of a message and abandon it, then check that the device drops it once the line goes idle.
+
+    Returns the get_stats response that follows, with the resyncs the abandoned message caused as "resynced", or the
+    failed response when the device does not answer.
+    """
+    write_rpc_message(ser, {"method": "get_stats", "params": {}})
+    before = read_rpc_response(ser)
+    if not before or before.get("status") != "success":
+        return before
+
+    cbor_data = cbor2.dumps({"method": "test", "params": {"message": "abandoned " * 8}})
+    ser.write(struct.pack(">I", len(cbor_data)) + cbor_data[: len(cbor_data) // 2])
+    sleep(2 * RESYNC_IDLE_MS / 1000)
+
+    write_rpc_message(ser, {"method": "get_stats", "params": {}})
+    after = read_rpc_response(ser)
+    if after and after.get("status") == "success":
+        after["resynced"] = after["resyncs"] - before["resyncs"]
+    return after
+
+
+@cli.command()
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3456, help="Renode USART6 TCP port")
+def resync(host: str, port: int):
+    """Check that the device recovers from a message abandoned partway"""
+    click.echo(f"Connecting to {host}:{port}")
+    ser = serial.serial_for_url(f"socket://{host}:{port}", timeout=2.0)
+    try:
+        ser.reset_input_buffer()
+        response = check_idle_resync(ser)
+    finally:
+        ser.close()
+
+    if not response or "resynced" not in response:
+        echo_response(response)
+        click.echo("✗ Device did not answer after the abandoned message")
+    elif response["resynced"]:
+        click.echo(f"✓ Device dropped the abandoned message after {RESYNC_IDLE_MS} ms of idle line")
+    else:
+        click.echo("⚠ Device answered but did not count a resync")
+
+
+# Binary trace records from USART1 when the firmware is built with LOG_TRACE (see log.h)
+TRACE_SYNC = 0xA5
+TRACE_FORMAT_SPEC = re.compile(r"%([-+ #0]*)(\d*)(?:\.(\d+))?(hh|h|ll|l|z|j|t)?([diouxXcspfeEgG%])")
+
+
+def read_log_formats(elf_path: Path) -> dict:
+    """Return the log format strings in a 32-bit little-endian ELF, keyed by their offset in .log_strings."""
+    elf = Path(elf_path).read_bytes()
+    if elf[:4] != b"\x7fELF" or elf[4] != 1 or elf[5] != 1:
+        raise click.ClickException(f"{elf_path} is not a 32-bit little-endian ELF file")
+
+    section_offset, section_size, section_count, names_index = struct.unpack_from("<I10xHHH", elf, 0x20)
+    sections = [struct.unpack_from("<IIIIII", elf, section_offset + i * section_size) for i in range(section_count)]
+    names_offset = sections[names_index][4]
+
+    for name, _, _, _, offset, size in sections:
+        if elf[names_offset + name : elf.index(b"\0", names_offset + name)] == b".log_strings":
+            strings = elf[offset : offset + size]
+            break
+    else:
+        raise click.ClickException(f"{elf_path} has no .log_strings section, was it built with LOG_TRACE?")
+
+    formats = {}
+    start = 0
+    while start < len(strings):
+        end = strings.find(b"\0", start)
+        if end < 0:
+            end = len(strings)
+        if end > start:
+            formats[start] = strings[start:end].decode("utf-8", errors="replace")
+        start = end + 1
+    return formats
+
+
+def read_varint(data: bytes, offset: int) -> tuple:
+    """Read a LEB128 varint and return (value, next offset), raising IndexError if data ends first."""
+    value = 0
+    shift = 0
+    while True:
+        byte = data[offset]
+        offset += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, offset
+
+
+def format_trace(fmt: str, args: list) -> str:
+    """Format a record's arguments with its C format string, marking any the device had no room for as ?."""
+    args = iter(args)
+
+    def replace(match):
+        flags, width, precision, _, conversion = match.groups()
+        if conversion == "%":
+            return "%"
+        value = next(args, None)
+        if value is None:
+            return "?"
+        # Integers arrive as 32-bit words, signed or not as the conversion says
+        if conversion in "di" and value & 0x80000000:
+            value -= 1 << 32
+        if conversion in "diu":
+            conversion = "d"
+        elif conversion == "c":
+            value, conversion = chr(value & 0xFF), "s"
+        elif conversion == "p":
+            flags, width, conversion = "#0", "10", "x"
+        precision = f".{precision}" if precision is not None else ""
+        return f"%{flags}{width}{precision}{conversion}" % value
+
+    return TRACE_FORMAT_SPEC.sub(replace, fmt).rstrip("\r\n")
+
+
+def decode_trace_record(body: bytes, formats: dict) -> Optional[tuple]:
+    """Decode the part of a record after its length byte into (tick, text), or None if it does not parse."""
+    if len(body) < 3:
+        return None
+    fmt = formats.get(body[0] | body[1] << 8)
+    if fmt is None:
+        return None
+
+    try:
+        tick, offset = read_varint(body, 2)
+    except IndexError:
+        return None
+
+    # The device drops arguments that do not fit in a record, so running out of bytes only cuts the line short
+    args = []
+    truncated = False
+    for match in TRACE_FORMAT_SPEC.finditer(fmt):
+        conversion = match.group(5)
+        if conversion == "%":
+            continue
+        if offset == len(body):
+            truncated = True
+            break
+        if conversion == "s":
+            length = body[offset]
+            if offset + 1 + length > len(body):
+                return None
+            args.append(body[offset + 1 : offset + 1 + length].decode("utf-8", errors="replace"))
+            offset += 1 + length
+        elif conversion in "feEgG":
+            if offset + 4 > len(body):
+                return None
+            args.append(struct.unpack_from("<f", body, offset)[0])
+            offset += 4
+        else:
+            try:
+                value, offset = read_varint(body, offset)
+            except IndexError:
+                return None
+            args.append(value)
+
+    if offset != len(body):
+        return None
+
+    text = format_trace(fmt, args)
+    return tick, text + " (truncated)" if truncated else text
+
+
+def decode_trace(data: bytes, formats: dict) -> tuple:
+    """Decode the complete records in a trace stream.
+
+    Returns (records, rest), where records holds (tick, text) per record and rest is an incomplete record at the end
+    to prepend to the next read. Bytes that do not start a valid record are skipped one at a time until one does.
+    """
+    records = []
+    start = 0
+    pending = None  # The first record that runs past the data, unless a complete one follows and shows it was noise
+    while True:
+        start = data.find(bytes([TRACE_SYNC]), start)
+        if start < 0:
+            return records, data[pending:] if pending is not None else b""
+
+        end = start + 2 + (data[start + 1] if start + 1 < len(data) else 0)
+        if end > len(data):
+            if pending is None:
+                pending = start
+            start += 1
+            continue
+
+        record = decode_trace_record(data[start + 2 : end], formats)
+        if record is None:
+            start += 1
+        else:
+            records.append(record)
+            pending = None
+            start = end
+
+
+def echo_trace_records(records: list):
+    for tick, text in records:
+        click.echo(f"[{tick / 1000:10.3f}] {text}")
+
+
+@cli.command()
+@click.argument("elf_path", type=click.Path(exists=True, path_type=Path), required=True)
+@click.option("--input", "input_path", type=click.Path(exists=True, path_type=Path), help="Decode a saved capture")
+@click.option("--host", default="localhost", help="Renode host address")
+@click.option("--port", default=3457, help="Renode USART1 TCP port")
+def trace(elf_path: Path, input_path: Optional[Path], host: str, port: int):
+    """Print the device's binary trace log as text, until interrupted
+
+    ELF_PATH: Firmware the device is running, which holds the format strings
+    """
+    formats = read_log_formats(elf_path)
+
+    if input_path is not None:
+        records, rest = decode_trace(input_path.read_bytes(), formats)
+        echo_trace_records(records)
+        if rest:
+            click.echo(f"⚠ Capture ends partway through a record ({len(rest)} bytes)")
+        return
+
+    click.echo(f"Connecting to {host}:{port}, {len(formats)} log formats loaded")
+    ser = serial.serial_for_url(f"socket://{host}:{port}", timeout=0.1)
+    rest = b""
+    try:
+        while True:
+            records, rest = decode_trace(rest + ser.read(ser.in_waiting or 1), formats)
+            echo_trace_records(records)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        ser.close()
+        click.echo("Connection closed")
+
+
+@cli.command()
+@click.option("-i", "--input", type=click.Path(exists=True, path_type=Path), required=True)
+@click.option("-o", "--output", type=click.Path(), required=True, help="Output C header file")
+@click.option("--columns", default=14, help="Number of values per line")
+def make_header(input: Path, output: Path, columns: int):
+    """Convert PNG image to C header file with RGB565 data."""
+    # Resize and crop image to 480x272 using the shared logic
+    processed_image = resize_image(input, 480, 272)
+
+    # Convert to RGB565
+    rgb565_data = convert_to_rgb565(processed_image)
+
+    # Convert RGB565 bytes to 16-bit values
+    values = [struct.unpack("<H", rgb565_data[i : i + 2])[0] for i in range(0, len(rgb565_data), 2)]
+
+    with open(output, "w") as f:
+        # Write header
+        f.write("// Generated automatically - do not edit\n")
+
+        # Generate values suitable for a C array
+        for i, val in enumerate(values):
+            f.write(f"0x{val:04X}")
+            if (i + 1) % columns == 0:
+                f.write(",\n")
+            else:
+                f.write(", ")
+
+        # Ensure we end with a newline if the last line wasn't complete
+        if len(values) % columns != 0:
+            f.write("\n")
+
+    click.echo(f"Generated {output} with {len(values)} uint16_t values (480x272 RGB565)")
+
+
+# Font atlases cover printable ASCII
+FONT_FIRST_CHAR = 32
+FONT_LAST_CHAR = 126
+
+
+def build_font_atlas(font, bits: int) -> tuple:
+    """Draw every printable ASCII glyph of a PIL font side by side into one alpha strip.
+
+    Returns (height, glyphs, atlas), where glyphs holds (x, width, offset, advance) per character: the glyph's column
+    in the atlas, its width, where it starts relative to the pen (negative for glyphs that overhang to the left) and
+    how far the pen moves after it. A4 glyphs get even columns and widths so each one starts on a byte.
+    """
+    chars = [chr(c) for c in range(FONT_FIRST_CHAR, FONT_LAST_CHAR + 1)]
+
+    # Every glyph is drawn with the top of the line at y = 0, so the line height covers ascenders and descenders
+    if hasattr(font, "getmetrics"):
+        height = sum(font.getmetrics())
+    else:
+        height = max(font.getbbox(c)[3] for c in chars)
+
+    cells = []
+    for c in chars:
+        left, _, right, _ = font.getbbox(c)
+        advance = round(font.getlength(c))
+        offset = min(0, left)
+        width = max(advance, right) - offset
+        if bits == 4:
+            width += width % 2
+        cells.append((c, width, offset, advance))
+
+    atlas = Image.new("L", (sum(cell[1] for cell in cells), height), 0)
+    glyphs = []
+    x = 0
+    for c, width, offset, advance in cells:
+        ImageDraw.Draw(atlas).text((x - offset, 0), c, font=font, fill=255)
+        glyphs.append((x, width, offset, advance))
+        x += width
+
+    return height, glyphs, atlas.tobytes()
+
+
+def pack_font_atlas(alpha: bytes, bits: int) -> bytes:
+    """Pack 8-bit atlas alpha as A8, or as A4 with two pixels per byte and the first one in the low nibble."""
+    if bits == 4:
+        return bytes((alpha[i] >> 4) | (alpha[i + 1] >> 4) << 4 for i in range(0, len(alpha), 2))
+    return bytes(alpha)
+
+
+def write_font_header(
+    output: Path,
+    name: str,
+    description: str,
+    bits: int,
+    height: int,
+    glyphs: list,
+    atlas: bytes,
+    columns: int = 16,
+):
+    """Write a font as a C header defining font_<name> (a font_t from text.h) and its atlas."""
+    atlas_width = sum(glyph[1] for glyph in glyphs)
+
+    with open(output, "w") as f:
+        f.write("// Generated automatically - do not edit\n")
+        f.write(f"// {description}, A{bits}, {atlas_width}x{height} atlas\n\n")
+
+        f.write(f"static const uint8_t font_{name}_atlas[] = {{\n")
+        for i in range(0, len(atlas), columns):
+            f.write("    " + ", ".join(f"0x{value:02X}" for value in atlas[i : i + columns]) + ",\n")
+        f.write("};\n\n")
+
+        f.write(f"static const font_glyph_t font_{name}_glyphs[] = {{\n")
+        for code, (x, width, offset, advance) in enumerate(glyphs, FONT_FIRST_CHAR):
+            f.write(f"    {{{x}, {width}, {offset}, {advance}}}, // '{chr(code)}'\n")
+        f.write("};\n\n")
+
+        f.write(f"static const font_t font_{name} = {{\n")
+        f.write(f"    .format = GFX_FORMAT_A{bits},\n")
+        f.write(f"    .height = {height},\n")
+        f.write(f"    .atlas_width = {atlas_width},\n")
+        f.write(f"    .first_char = {FONT_FIRST_CHAR},\n")
+        f.write(f"    .glyph_count = {len(glyphs)},\n")
+        f.write(f"    .glyphs = font_{name}_glyphs,\n")
+        f.write(f"    .atlas = font_{name}_atlas,\n")
+        f.write("};\n")
+
+
+@cli.command()
+@click.option("-i", "--input", type=click.Path(exists=True, path_type=Path), required=True, help="TrueType font")
+@click.option("-o", "--output", type=click.Path(), required=True, help="Output C header file")
+@click.option("--size", default=16, help="Font size in pixels")
+@click.option("--bits", type=click.Choice(["4", "8"]), default="4", help="Alpha bits per pixel (A4 or A8)")
+@click.option("--name", required=True, help="Font name used in the C identifiers, e.g. mono16")
+def make_font(input: Path, output: Path, size: int, bits: str, name: str):
+    """Convert a TrueType font to a C header with a printable ASCII glyph atlas."""
+    if not name.isidentifier():
+        raise click.BadParameter("name must be a valid C identifier")
+
+    font = ImageFont.truetype(str(input), size)
+    height, glyphs, alpha = build_font_atlas(font, int(bits))
+    atlas = pack_font_atlas(alpha, int(bits))
+
+    write_font_header(output, name, f"{input.name} at {size} px", int(bits), height, glyphs, atlas)
+
+    click.echo(f"Generated {output} with {len(glyphs)} glyphs ({len(atlas)} bytes, A{bits}, {height} px high)")
@@ -0,0 +1,152 @@
+import re
+from pathlib import Path
+from typing import Optional
+
+import click
+
+FRAME_WIDTH = 480
+FRAME_HEIGHT = 272
+FRAME_SIZE = FRAME_WIDTH * FRAME_HEIGHT * 2  # RGB565
+
+# Tiles are compared as whole byte runs, 16x16 pixels keeps the tile grid small (30x17) and the rectangles tight
+TILE_SIZE = 16
+
+# CBOR bytes around each rectangle's data in a display_region message (keys and coordinates), at most 38 in practice
+REGION_OVERHEAD = 48
+
+
+def dirty_tiles(old_frame: bytes, new_frame: bytes, tile_size: int = TILE_SIZE) -> list:
+    """Return a grid of booleans, one per tile, that marks the tiles where the two frames differ."""
+    tiles_x = (FRAME_WIDTH + tile_size - 1) // tile_size
+    tiles_y = (FRAME_HEIGHT + tile_size - 1) // tile_size
+    dirty = [[False] * tiles_x for _ in range(tiles_y)]
+
+    row_size = FRAME_WIDTH * 2
+    tile_bytes = tile_size * 2
+
+    for y in range(FRAME_HEIGHT):
+        start = y * row_size
+        end = start + row_size
+
+        # Most rows of a dashboard-style update are unchanged, so compare whole rows before looking at tiles
+        if old_frame[start:end] == new_frame[start:end]:
+            continue
+
+        tile_row = dirty[y // tile_size]
+        for tx in range(tiles_x):
+            if tile_row[tx]:
+                continue
+            tile_start = start + tx * tile_bytes
+            tile_end = min(tile_start + tile_bytes, end)
+            if old_frame[tile_start:tile_end] != new_frame[tile_start:tile_end]:
+                tile_row[tx] = True
+
+    return dirty
+
+
+def merge_tiles(dirty: list, tile_size: int = TILE_SIZE) -> list:
+    """Merge dirty tiles into (x, y, width, height) pixel rectangles.
+
+    Horizontal runs of dirty tiles become spans, and spans that repeat on consecutive tile rows grow downwards.
+    """
+    rectangles = []
+    open_spans = {}  # (first tile, last tile + 1) -> [first tile row, tile row count]
+
+    for ty, tile_row in enumerate(dirty + [[]]):
+        spans = set()
+        tx = 0
+        while tx < len(tile_row):
+            if tile_row[tx]:
+                start = tx
+                while tx < len(tile_row) and tile_row[tx]:
+                    tx += 1
+                spans.add((start, tx))
+            else:
+                tx += 1
+
+        # Close the spans that did not continue on this row
+        for span in list(open_spans):
+            if span in spans:
+                open_spans[span][1] += 1
+                spans.discard(span)
+            else:
+                first_row, rows = open_spans.pop(span)
+                rectangles.append(tile_rectangle(span, first_row, rows, tile_size))
+
+        for span in spans:
+            open_spans[span] = [ty, 1]
+
+    return sorted(rectangles, key=lambda r: (r[1], r[0]))
+
+
+def tile_rectangle(span: tuple, first_row: int, rows: int, tile_size: int) -> tuple:
+    """Convert a span of tiles to a pixel rectangle clipped to the frame."""
+    x = span[0] * tile_size
+    y = first_row * tile_size
+    width = min(span[1] * tile_size, FRAME_WIDTH) - x
+    height = min((first_row + rows) * tile_size, FRAME_HEIGHT) - y
+    return (x, y, width, height)
+
+
+def diff_frames(
+    old_frame: Optional[bytes], new_frame: bytes, full_size: int = FRAME_SIZE, tile_size: int = TILE_SIZE
+) -> Optional[list]:
+    """Return the rectangles that changed between two frames, or None when sending the whole frame is cheaper.
+
+    full_size is what the whole frame costs to send, which is less than FRAME_SIZE for palettized formats.
+    """
+    if old_frame is None or len(old_frame) != FRAME_SIZE or len(new_frame) != FRAME_SIZE:
+        return None
+
+    rectangles = merge_tiles(dirty_tiles(old_frame, new_frame, tile_size), tile_size)
+
+    cost = sum(width * height * 2 + REGION_OVERHEAD for _, _, width, height in rectangles)
+    if cost >= full_size:
+        return None
+
+    return rectangles
+
+
+def cache_dir() -> Path:
+    """Directory that holds the last frame sent to each device."""
+    return Path(click.get_app_dir("cbor-host")) / "frames"
+
+
+def frame_cache_path(host: str, port: int) -> Path:
+    """Cache file for the device at host:port."""
+    return cache_dir() / f"{re.sub(r'[^A-Za-z0-9.-]', '_', host)}_{port}.rgb565"
+
+
+def load_last_frame(host: str, port: int) -> Optional[bytes]:
+    """Return the last frame sent to a device, or None if it is not known."""
+    try:
+        frame = frame_cache_path(host, port).read_bytes()
+    except OSError:
+        return None
+    return frame if len(frame) == FRAME_SIZE else None
+
+
+def save_last_frame(host: str, port: int, frame: bytes):
+    """Remember the frame now shown on a device."""
+    path = frame_cache_path(host, port)
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_bytes(frame)
+
+
+def forget_last_frame(host: str, port: int):
+    """Drop the cached frame when the device shows something the host cannot reproduce."""
+    frame_cache_path(host, port).unlink(missing_ok=True)
+
+
+def update_last_frame(host: str, port: int, x: int, y: int, width: int, height: int, data: bytes):
+    """Apply a rectangle of packed RGB565 rows to the remembered frame, if there is one."""
+    last_frame = load_last_frame(host, port)
+    if last_frame is None:
+        return
+
+    updated = bytearray(last_frame)
+    row_size = width * 2
+    for row in range(height):
+        start = ((y + row) * FRAME_WIDTH + x) * 2
+        updated[start : start + row_size] = data[row * row_size : (row + 1) * row_size]
+    save_last_frame(host, port, bytes(updated))
@@ -1,10 +1,41 @@
+import struct
 import tempfile
+import time
 from pathlib import Path
 
+import cbor2
+import click
+import pytest
 from click.testing import CliRunner
-from PIL import Image
-
-from cbor_host.cli import cli
+from PIL import Image, ImageFont
+
+from cbor_host import frame_diff
+from cbor_host.cli import (
+    FONT_FIRST_CHAR,
+    FONT_LAST_CHAR,
+    CBOR_BUFFER_SIZE,
+    MAX_CHUNK_SIZE,
+    RESYNC_IDLE_MS,
+    build_font_atlas,
+    build_region_messages,
+    build_render_commands,
+    build_stream_frame,
+    bucket_percentile,
+    check_idle_resync,
+    cli,
+    convert_to_alpha,
+    convert_to_argb4444,
+    convert_to_argb8888,
+    convert_to_indexed,
+    decode_trace,
+    extract_region,
+    pack_font_atlas,
+    read_profile,
+    read_stats,
+    read_log_formats,
+    send_image_chunked,
+    stream_frames,
+)
 
 
 def test_version():
@@ -24,6 +55,8 @@ def test_cli_help():
     assert "display" in result.output
     assert "test" in result.output
     assert "make-header" in result.output
+    assert "region" in result.output
+    assert "fill" in result.output
 
 
 def test_clear_subcommand_help():
@@ -44,6 +77,10 @@ def test_display_subcommand_help():
     assert "Display an image on the LCD screen" in result.output
     assert "IMAGE_PATH" in result.output
     assert "optional" in result.output
+    assert "--chunked" in result.output
+    assert "--chunk-size" in result.output
+    assert "--window" in result.output
+    assert "--format" in result.output
 
 
 def test_display_with_nonexistent_image():
@@ -211,3 +248,710 @@ def test_make_header_conversion_with_custom_columns():
     finally:
         Path(input_file).unlink(missing_ok=True)
         Path(output_file).unlink(missing_ok=True)
+
+
+class FakeDevice:
+    """Serial stand-in that decodes length-prefixed CBOR requests and answers them in order like the firmware."""
+
+    def __init__(self, handler):
+        self.handler = handler
+        self.requests = []
+        self.responses = []  # Encoded responses, None for a request that is never answered
+        self.pending = b""
+        self.in_flight = 0
+        self.max_in_flight = 0
+
+    def write(self, data: bytes):
+        length = struct.unpack(">I", data[:4])[0]
+        request = cbor2.loads(data[4 : 4 + length])
+        self.requests.append(request)
+        self.in_flight += 1
+        self.max_in_flight = max(self.max_in_flight, self.in_flight)
+
+        response = self.handler(request)
+        if response is not None:
+            body = cbor2.dumps(response)
+            response = struct.pack(">I", len(body)) + body
+        self.responses.append(response)
+
+    def read(self, size: int) -> bytes:
+        if not self.pending:
+            if not self.responses:
+                return b""
+            self.in_flight -= 1
+            response = self.responses.pop(0)
+            if response is None:
+                # A lost request reads back as a timeout
+                return b""
+            self.pending = response
+
+        data, self.pending = self.pending[:size], self.pending[size:]
+        return data
+
+    def reset_input_buffer(self):
+        self.pending = b""
+
+    @property
+    def in_waiting(self) -> int:
+        return len(self.pending) or sum(1 for response in self.responses if response is not None)
+
+
+def make_upload_handler(image_size: int, drop_offsets: set):
+    """Device-side image_begin/image_chunk/image_commit that loses the first copy of the chunks in drop_offsets."""
+    received = bytearray(image_size)
+    seen = set()
+
+    def handler(request):
+        method = request["method"]
+        params = request["params"]
+        if method == "image_begin":
+            return {"status": "success", "message": "Image upload started"}
+        if method == "image_chunk":
+            offset = params["offset"]
+            if offset in drop_offsets:
+                drop_offsets.discard(offset)
+                return None
+            received[offset : offset + len(params["data"])] = params["data"]
+            seen.add(offset)
+            return {"status": "success", "message": "Chunk received", "offset": offset}
+        return {"status": "success", "message": "Image displayed successfully", "offset": image_size}
+
+    return handler, received, seen
+
+
+def test_chunked_upload_keeps_window_full():
+    """Test that a chunked upload sends every chunk once with at most `window` in flight"""
+    image_data = bytes(range(256)) * 40
+    handler, received, _ = make_upload_handler(len(image_data), set())
+    device = FakeDevice(handler)
+
+    response = send_image_chunked(device, image_data, chunk_size=1024, window=3)
+
+    assert response["status"] == "success"
+    assert bytes(received) == image_data
+    chunk_offsets = [r["params"]["offset"] for r in device.requests if r["method"] == "image_chunk"]
+    assert chunk_offsets == list(range(0, len(image_data), 1024))
+    assert device.max_in_flight == 3
+
+
+def test_chunked_upload_resends_only_dropped_chunk():
+    """Test that a chunk whose acknowledgement never arrives is resent on its own"""
+    image_data = bytes(range(256)) * 40
+    handler, received, _ = make_upload_handler(len(image_data), {2048})
+    device = FakeDevice(handler)
+
+    response = send_image_chunked(device, image_data, chunk_size=1024, window=4)
+
+    assert response["status"] == "success"
+    assert bytes(received) == image_data
+    chunk_offsets = [r["params"]["offset"] for r in device.requests if r["method"] == "image_chunk"]
+    assert chunk_offsets.count(2048) == 2
+    assert len(chunk_offsets) == len(range(0, len(image_data), 1024)) + 1
+
+
+def test_chunked_upload_rejects_unaligned_chunk_size():
+    """Test that chunk sizes must be a multiple of the device block size"""
+    device = FakeDevice(lambda request: None)
+    with pytest.raises(Exception, match="multiple of 512"):
+        send_image_chunked(device, b"\0" * 4096, chunk_size=1000)
+    assert device.requests == []
+
+
+def test_largest_chunk_fits_device_message_buffer():
+    """Test that the largest allowed chunk, with its RPC header and length prefix, fits the device's message buffer"""
+    message = {"method": "image_chunk", "params": {"offset": 480 * 272 * 2, "data": b"\0" * MAX_CHUNK_SIZE}}
+
+    assert MAX_CHUNK_SIZE % 512 == 0
+    assert MAX_CHUNK_SIZE > 4096
+    assert len(cbor2.dumps(message)) <= CBOR_BUFFER_SIZE
+
+
+def test_region_subcommand_help():
+    """Test that region subcommand help displays correctly"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["region", "--help"])
+    assert result.exit_code == 0
+    assert "Update one rectangle of the LCD screen" in result.output
+    assert "--width" in result.output
+    assert "--height" in result.output
+
+
+def test_extract_region_packs_rows():
+    """Test that a region is cut out of a frame as packed rows"""
+    frame = b"".join(struct.pack("<H", i & 0xFFFF) for i in range(480 * 272))
+    data = extract_region(frame, 10, 20, 3, 2)
+    first_row = 20 * 480 + 10
+    second_row = 21 * 480 + 10
+    expected = [*range(first_row, first_row + 3), *range(second_row, second_row + 3)]
+    assert list(struct.unpack("<6H", data)) == expected
+
+
+def test_build_region_messages_splits_large_regions():
+    """Test that regions are batched per message and split into row bands when they exceed the device buffer"""
+    frame = bytes(480 * 272 * 2)
+
+    messages = build_region_messages(frame, [(0, 0, 8, 8), (16, 16, 8, 8)])
+    assert len(messages) == 1
+    assert [r["x"] for r in messages[0]["params"]["regions"]] == [0, 16]
+
+    messages = build_region_messages(frame, [(0, 0, 480, 272)])
+    regions = [r for m in messages for r in m["params"]["regions"]]
+    assert sum(r["height"] for r in regions) == 272
+    assert all(len(cbor2.dumps(m)) <= CBOR_BUFFER_SIZE for m in messages)
+
+
+def test_build_region_messages_counts_cbor_per_region():
+    """Test that many small regions are split by their encoded size, which includes the CBOR around each one"""
+    frame = bytes(480 * 272 * 2)
+    tiles = [(x * 32 % 480, x * 32 // 480 * 32, 16, 16) for x in range(64)]
+
+    messages = build_region_messages(frame, tiles)
+
+    assert len(messages) > 1
+    assert sum(len(m["params"]["regions"]) for m in messages) == 64
+    assert all(len(cbor2.dumps(m)) <= CBOR_BUFFER_SIZE for m in messages)
+
+
+def make_frame(changes: dict = None) -> bytearray:
+    """Return a black 480x272 RGB565 frame with the given {(x, y): pixel} changes applied."""
+    frame = bytearray(frame_diff.FRAME_SIZE)
+    for (x, y), pixel in (changes or {}).items():
+        struct.pack_into("<H", frame, (y * 480 + x) * 2, pixel)
+    return frame
+
+
+def test_diff_frames_unchanged():
+    """Test that identical frames produce no rectangles"""
+    assert frame_diff.diff_frames(bytes(make_frame()), bytes(make_frame())) == []
+
+
+def test_diff_frames_single_tile():
+    """Test that a single changed pixel produces the rectangle of its tile"""
+    new_frame = make_frame({(37, 100): 0xFFFF})
+    assert frame_diff.diff_frames(bytes(make_frame()), bytes(new_frame)) == [(32, 96, 16, 16)]
+
+
+def test_diff_frames_merges_adjacent_tiles():
+    """Test that neighbouring dirty tiles merge into one rectangle and distant ones stay separate"""
+    changes = {(x, y): 0x1234 for x in range(0, 40) for y in range(0, 20)}
+    changes[(470, 260)] = 0xF800
+    rectangles = frame_diff.diff_frames(bytes(make_frame()), bytes(make_frame(changes)))
+    assert rectangles == [(0, 0, 48, 32), (464, 256, 16, 16)]
+
+
+def test_diff_frames_falls_back_to_full_frame():
+    """Test that a frame that changed everywhere is sent whole"""
+    new_frame = bytes([0xFF]) * frame_diff.FRAME_SIZE
+    assert frame_diff.diff_frames(bytes(make_frame()), new_frame) is None
+    assert frame_diff.diff_frames(None, new_frame) is None
+
+
+def test_diff_frames_is_fast():
+    """Test that the tile diff of two 480x272 frames stays in the millisecond range"""
+    old_frame = bytes(make_frame())
+    new_frame = bytes(make_frame({(x, y): 0xFFFF for x in range(0, 480, 7) for y in range(0, 272, 5)}))
+
+    start = time.perf_counter()
+    for _ in range(10):
+        frame_diff.diff_frames(old_frame, new_frame)
+    elapsed = (time.perf_counter() - start) / 10
+
+    assert elapsed < 0.05
+
+
+def test_last_frame_cache_round_trip(tmp_path, monkeypatch):
+    """Test that the last frame is remembered per device and can be forgotten"""
+    monkeypatch.setattr(frame_diff, "cache_dir", lambda: tmp_path)
+    frame = bytes(make_frame({(1, 1): 0xABCD}))
+
+    assert frame_diff.load_last_frame("localhost", 3456) is None
+    frame_diff.save_last_frame("localhost", 3456, frame)
+    assert frame_diff.load_last_frame("localhost", 3456) == frame
+    assert frame_diff.load_last_frame("localhost", 3457) is None
+
+    frame_diff.forget_last_frame("localhost", 3456)
+    assert frame_diff.load_last_frame("localhost", 3456) is None
+
+
+def make_four_colour_image() -> Image.Image:
+    """Return a 480x272 image made of four solid vertical bands."""
+    image = Image.new("RGB", (480, 272))
+    for band, colour in enumerate([(255, 0, 0), (0, 255, 0), (0, 0, 255), (255, 255, 255)]):
+        image.paste(colour, (band * 120, 0, (band + 1) * 120, 272))
+    return image
+
+
+def test_convert_to_indexed_l8():
+    """Test that L8 conversion produces one index per pixel and an RGB888 palette"""
+    palette, pixels, quantized = convert_to_indexed(make_four_colour_image(), "l8")
+    assert len(pixels) == 480 * 272
+    assert len(palette) % 3 == 0
+    assert len(palette) // 3 > max(pixels)
+    assert quantized.getpixel((10, 10)) == tuple(palette[pixels[10 * 480 + 10] * 3 : pixels[10 * 480 + 10] * 3 + 3])
+
+
+def test_convert_to_indexed_l4_packs_two_pixels_per_byte():
+    """Test that L4 conversion packs the first pixel of each pair in the low nibble"""
+    palette, pixels, _ = convert_to_indexed(make_four_colour_image(), "l4")
+    assert len(pixels) == 480 * 272 // 2
+    assert len(palette) // 3 <= 16
+
+    # Each band is a single colour, so both nibbles of a byte inside one band hold the same index
+    assert pixels[0] & 0x0F == pixels[0] >> 4
+    assert len({pixels[0], pixels[60], pixels[120], pixels[180]}) == 4
+
+
+def test_display_rejects_chunked_indexed_image():
+    """Test that chunked uploads are limited to RGB565"""
+    runner = CliRunner()
+    with tempfile.NamedTemporaryFile(suffix=".png", delete=False) as img_file:
+        make_four_colour_image().save(img_file.name)
+        input_file = img_file.name
+
+    try:
+        result = runner.invoke(cli, ["display", input_file, "--format", "l4", "--chunked"])
+        assert result.exit_code != 0
+        assert "--chunked only supports the rgb565 format" in result.output
+    finally:
+        Path(input_file).unlink(missing_ok=True)
+
+
+def test_fill_subcommand_help():
+    """Test that fill subcommand help displays correctly"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["fill", "--help"])
+    assert result.exit_code == 0
+    assert "Fill a rectangle of the LCD screen with a solid colour" in result.output
+    assert "--color" in result.output
+
+
+def test_fill_rejects_invalid_color():
+    """Test that fill rejects colours that are not 16-bit RGB565 values"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["fill", "--color", "0x10000"])
+    assert result.exit_code != 0
+    assert "16-bit RGB565" in result.output
+
+
+def test_update_last_frame_applies_rectangle(tmp_path, monkeypatch):
+    """Test that a rectangle update is applied to the remembered frame"""
+    monkeypatch.setattr(frame_diff, "cache_dir", lambda: tmp_path)
+    frame_diff.save_last_frame("localhost", 3456, bytes(make_frame()))
+
+    frame_diff.update_last_frame("localhost", 3456, 2, 3, 2, 1, struct.pack("<2H", 0xF800, 0x07E0))
+
+    expected = bytes(make_frame({(2, 3): 0xF800, (3, 3): 0x07E0}))
+    assert frame_diff.load_last_frame("localhost", 3456) == expected
+
+
+def test_display_sends_whole_frame_when_regions_need_several_messages(tmp_path, monkeypatch):
+    """Test that a diff too large for one display_region message is sent as a whole frame instead"""
+    image_path = tmp_path / "black.png"
+    Image.new("RGB", (480, 272)).save(image_path)
+    monkeypatch.setattr(frame_diff, "cache_dir", lambda: tmp_path)
+    scattered = {(x, y): 0xFFFF for x in range(0, 480, 32) for y in range(0, 272, 32)}
+    frame_diff.save_last_frame("localhost", 3456, bytes(make_frame(scattered)))
+    sent = []
+    monkeypatch.setattr(
+        "cbor_host.cli.send_rpc_message", lambda message, *args, **kwargs: sent.append(message) or {"status": "success"}
+    )
+
+    result = CliRunner().invoke(cli, ["display", str(image_path)])
+
+    assert result.exit_code == 0
+    assert [message["method"] for message in sent] == ["display_image"]
+
+
+def test_store_subcommand_help():
+    """Test that store subcommand help displays correctly"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["store", "--help"])
+    assert result.exit_code == 0
+    assert "Preload an image into a slot on the device" in result.output
+    assert "--slot" in result.output
+
+
+def test_show_rejects_out_of_range_slot():
+    """Test that show only accepts the device's slot numbers"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["show", "--slot", "24"])
+    assert result.exit_code != 0
+    assert "--slot" in result.output
+
+
+def test_overlay_subcommand_help():
+    """Test that overlay subcommand help lists its commands"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["overlay", "--help"])
+    assert result.exit_code == 0
+    for command in ("upload", "move", "alpha", "key"):
+        assert command in result.output
+
+
+def test_overlay_key_needs_color_or_off():
+    """Test that overlay key takes exactly one of --color and --off"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["overlay", "key"])
+    assert result.exit_code != 0
+    assert "give either --color or --off" in result.output
+
+
+def test_convert_to_argb8888_keeps_alpha():
+    """Test that ARGB8888 conversion packs little-endian 0xAARRGGBB words"""
+    image = Image.new("RGBA", (2, 1))
+    image.putpixel((0, 0), (0x11, 0x22, 0x33, 0x80))
+    image.putpixel((1, 0), (0xFF, 0x00, 0x00, 0x00))
+
+    assert convert_to_argb8888(image) == struct.pack("<2I", 0x80112233, 0x00FF0000)
+
+
+def test_convert_to_argb4444_keeps_top_bits():
+    """Test that ARGB4444 conversion keeps the top four bits of each channel"""
+    image = Image.new("RGBA", (1, 1), (0x12, 0x34, 0x56, 0xF8))
+    assert convert_to_argb4444(image) == struct.pack("<H", 0xF135)
+
+
+def test_convert_to_alpha_packs_a4():
+    """Test that A4 masks come from the alpha channel and pack two pixels per byte"""
+    image = Image.new("RGBA", (2, 1))
+    image.putpixel((0, 0), (0, 0, 0, 0x10))
+    image.putpixel((1, 0), (0, 0, 0, 0xF0))
+
+    assert convert_to_alpha(image, 8) == bytes([0x10, 0xF0])
+    assert convert_to_alpha(image, 4) == bytes([0xF1])
+
+
+def test_asset_upload_rejects_odd_a4_width(tmp_path):
+    """Test that A4 assets need an even width"""
+    path = tmp_path / "icon.png"
+    Image.new("RGB", (3, 2)).save(path)
+
+    runner = CliRunner()
+    result = runner.invoke(cli, ["asset", "upload", str(path), "--id", "0", "--format", "a4"])
+    assert result.exit_code != 0
+    assert "a4 assets need an even width" in result.output
+
+
+def test_build_render_commands_cuts_regions_from_images(tmp_path):
+    """Test that region commands naming an image carry that rectangle's RGB565 pixels"""
+    Image.new("RGB", (480, 272), (255, 0, 0)).save(tmp_path / "red.png")
+    spec = [["fill_rect", 0, 0, 480, 40, 0x001F], ["region", 10, 20, 3, 2, "red.png"]]
+
+    commands = build_render_commands(spec, tmp_path)
+
+    assert commands[0] == ["fill_rect", 0, 0, 480, 40, 0x001F]
+    assert commands[1] == ["region", 10, 20, 3, 2, struct.pack("<H", 0xF800) * 6]
+
+
+def test_build_render_commands_rejects_malformed_command():
+    """Test that every command must be an array starting with its name"""
+    with pytest.raises(click.BadParameter):
+        build_render_commands([{"op": "fill_rect"}])
+
+
+def test_render_subcommand_help():
+    """Test that render subcommand help displays correctly"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["render", "--help"])
+    assert result.exit_code == 0
+    assert "Draw a display list in one request" in result.output
+
+
+def test_text_rejects_position_off_screen():
+    """Test that text has to start on the screen"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["text", "Hello", "--x", "480"])
+    assert result.exit_code != 0
+    assert "text must start on the 480x272 screen" in result.output
+
+
+def test_build_font_atlas_a4_cells_start_on_bytes():
+    """Test that the atlas covers printable ASCII with even A4 cells laid side by side"""
+    height, glyphs, alpha = build_font_atlas(ImageFont.load_default(), 4)
+
+    assert len(glyphs) == FONT_LAST_CHAR - FONT_FIRST_CHAR + 1
+    atlas_width = sum(width for _, width, _, _ in glyphs)
+    assert len(alpha) == atlas_width * height
+    for (x, width, offset, advance), (next_x, _, _, _) in zip(glyphs, glyphs[1:]):
+        assert x % 2 == 0 and width % 2 == 0
+        assert next_x == x + width
+        assert offset <= 0 and advance > 0
+
+
+def test_pack_font_atlas_a4():
+    """Test that A4 atlases keep the top nibble of each pixel, first pixel in the low nibble"""
+    assert pack_font_atlas(bytes([0x10, 0xF0, 0xFF, 0x00]), 4) == bytes([0xF1, 0x0F])
+    assert pack_font_atlas(bytes([0x10, 0xF0]), 8) == bytes([0x10, 0xF0])
+
+
+def test_plot_create_rejects_empty_range():
+    """Test that a plot's minimum has to be below its maximum"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["plot", "create", "--id", "0", "--min", "10", "--max", "10"])
+    assert result.exit_code != 0
+    assert "--min must be less than --max" in result.output
+
+
+def test_plot_append_rejects_too_many_samples():
+    """Test that one append carries at most a full-width plot's worth of samples"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["plot", "append", "--id", "0"] + ["1"] * 481)
+    assert result.exit_code != 0
+    assert "at most 480 samples" in result.output
+
+
+def test_play_rejects_out_of_range_fps():
+    """Test that the frame rate is limited to what the LCD can show"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["play", "0", "1", "--fps", "61"])
+    assert result.exit_code != 0
+
+
+def test_play_rejects_long_sequence():
+    """Test that a sequence fits the device's frame table"""
+    runner = CliRunner()
+    result = runner.invoke(cli, ["play"] + ["0"] * 65)
+    assert result.exit_code != 0
+    assert "at most 64 frames" in result.output
+
+
+def make_stream_handler(shown: list):
+    """Device-side stream_begin/stream_frame/stream_end that records the sequence numbers it shows."""
+
+    def handler(request):
+        method = request["method"]
+        if method == "stream_begin":
+            return {"status": "success", "message": "Stream started", "credits": 2}
+        if method == "stream_frame":
+            shown.append(request["params"]["seq"])
+            return {"status": "success", "message": "Frame shown", "seq": shown[-1], "credits": 1, "fps": 30.0}
+        return {"status": "success", "message": "Stream ended", "frames": len(shown), "fps": 30.0}
+
+    return handler
+
+
+class FakeClock:
+    """Clock that only moves when the code under test sleeps or sends a frame."""
+
+    def __init__(self):
+        self.now = 0.0
+
+    def __call__(self) -> float:
+        return self.now
+
+    def sleep(self, seconds: float):
+        self.now += max(seconds, 0.001)
+
+
+def test_build_stream_frame_sends_changed_regions():
+    """Test that a stream frame carries only the changed tiles when the previous frame is known"""
+    old_frame = bytes(frame_diff.FRAME_SIZE)
+    new_frame = bytearray(old_frame)
+    new_frame[0:2] = b"\xff\xff"
+
+    message = build_stream_frame(7, bytes(new_frame), old_frame)
+
+    assert message["params"]["seq"] == 7
+    assert [(r["x"], r["y"], r["width"], r["height"]) for r in message["params"]["regions"]] == [(0, 0, 16, 16)]
+
+
+def test_build_stream_frame_regions_fit_device_message_buffer():
+    """Test that a delta frame is only sent as regions when its encoded message fits the device's message buffer"""
+    old_frame = bytes(frame_diff.FRAME_SIZE)
+    most_regions = 0
+
+    for count in range(1, 40):
+        tiles = {(n * 32 % 480, n * 32 // 480 * 32): 0xFFFF for n in range(count)}
+        message = build_stream_frame(1000, bytes(make_frame(tiles)), old_frame)
+
+        if "regions" in message["params"]:
+            assert len(cbor2.dumps(message)) <= CBOR_BUFFER_SIZE
+            most_regions = count
+
+    assert 25 <= most_regions < 39
+
+
+def test_build_stream_frame_sends_whole_frame_without_base():
+    """Test that the first frame of a stream goes whole, with the pixels last so the device streams them"""
+    frame = bytes(frame_diff.FRAME_SIZE)
+
+    message = build_stream_frame(1, frame, None)
+
+    assert list(message["params"]) == ["seq", "image_data"]
+
+
+def test_stream_frames_keeps_credits_and_skips_stale_frames():
+    """Test that at most the granted credits are in flight and every frame sent is the newest one due"""
+    frames = [bytes([i]) * frame_diff.FRAME_SIZE for i in range(4)]
+    shown = []
+    device = FakeDevice(make_stream_handler(shown))
+    clock = FakeClock()
+
+    def write(data, original=device.write):
+        # Each frame takes a tenth of a second to send, three frame times at 30 fps
+        clock.now += 0.1
+        original(data)
+
+    device.write = write
+
+    summary = stream_frames(device, frames, fps=30, duration=1.0, credits=4, clock=clock, sleep=clock.sleep)
+
+    assert summary["status"] == "success"
+    assert device.max_in_flight == 2  # The credits the device granted, not the four asked for
+    assert shown == sorted(shown) and len(shown) == summary["sent"]
+    assert summary["skipped"] > 0
+    assert device.requests[-1]["method"] == "stream_end"
+
+
+def build_elf(sections: dict) -> bytes:
+    """Build a 32-bit little-endian ELF holding only the given sections, enough for read_log_formats."""
+    names = b"\0" + b"".join(name.encode() + b"\0" for name in [".shstrtab", *sections])
+    contents = [b"", names, *sections.values()]
+    name_offsets = [0] + [names.index(name.encode() + b"\0") for name in [".shstrtab", *sections]]
+
+    body = b""
+    offsets = []
+    for content in contents:
+        offsets.append(52 + len(body))
+        body += content
+
+    header = b"\x7fELF\x01\x01\x01" + bytes(9)
+    header += struct.pack("<HHIIIIIHHHHHH", 2, 40, 1, 0, 0, 52 + len(body), 0, 52, 0, 0, 40, len(contents), 1)
+    section_headers = b"".join(
+        struct.pack("<IIIIIIIIII", name, 1, 0, 0, offset, len(content), 0, 0, 1, 0)
+        for name, offset, content in zip(name_offsets, offsets, contents)
+    )
+    return header + body + section_headers
+
+
+def trace_record(format_id: int, tick: bytes, args: bytes) -> bytes:
+    body = struct.pack("<H", format_id) + tick + args
+    return bytes([0xA5, len(body)]) + body
+
+
+def test_read_log_formats_keys_strings_by_offset(tmp_path):
+    """Test that each format string is found at the offset the device sends as its ID"""
+    elf_path = tmp_path / "Device.elf"
+    elf_path.write_bytes(build_elf({".text": b"\0" * 8, ".log_strings": b"Bootup complete\r\n\0Slot %u\r\n\0"}))
+
+    assert read_log_formats(elf_path) == {0: "Bootup complete\r\n", 18: "Slot %u\r\n"}
+
+
+def test_read_log_formats_needs_trace_build(tmp_path):
+    """Test that an ELF built without LOG_TRACE is reported rather than decoded as nothing"""
+    elf_path = tmp_path / "Device.elf"
+    elf_path.write_bytes(build_elf({".text": b"\0" * 8}))
+
+    with pytest.raises(click.ClickException, match="no .log_strings"):
+        read_log_formats(elf_path)
+
+
+def test_decode_trace_formats_arguments():
+    """Test that varint, string and float arguments are printed with their C conversions"""
+    formats = {0x1234: "Error %d in %s at 0x%08lX (%zu%%, %.1f)\r\n"}
+    args = b"\xfd\xff\xff\xff\x0f" + b"\x04comm" + b"\xef\xfd\x03" + b"\x32" + struct.pack("<f", 2.5)
+
+    records, rest = decode_trace(trace_record(0x1234, b"\xb9\x60", args), formats)
+
+    assert records == [(12345, "Error -3 in comm at 0x0000FEEF (50%, 2.5)")]
+    assert rest == b""
+
+
+def test_decode_trace_resyncs_and_keeps_partial_record():
+    """Test that noise and unknown IDs are skipped and a record split across reads is decoded once complete"""
+    formats = {4: "Slot %u\r\n"}
+    record = trace_record(4, b"\x01", b"\x07")
+    stream = b"\x00\xa5\x01\xa5" + trace_record(9, b"\x01", b"") + record + record[:3]
+
+    records, rest = decode_trace(stream, formats)
+    assert records == [(1, "Slot 7")]
+    assert rest == record[:3]
+
+    records, rest = decode_trace(rest + record[3:], formats)
+    assert records == [(1, "Slot 7")]
+    assert rest == b""
+
+
+def test_decode_trace_marks_truncated_record():
+    """Test that a record the device ran out of room for keeps the arguments it has"""
+    records, _ = decode_trace(trace_record(0, b"\x02", b"\x05"), {0: "%u of %u\r\n"})
+
+    assert records == [(2, "5 of ? (truncated)")]
+
+
+def test_read_profile_reads_every_stage_then_resets():
+    """Test that get_profile is asked for each stage the device reports and the reset comes after the last one"""
+
+    def handler(request):
+        stage = request["params"]["stage"]
+        return {"status": "success", "message": "Profile read", "stage": f"s{stage}", "index": stage, "stages": 3}
+
+    device = FakeDevice(handler)
+
+    stages = read_profile(device, reset=True)
+
+    assert [stage["stage"] for stage in stages] == ["s0", "s1", "s2"]
+    assert [request["params"] for request in device.requests] == [
+        {"stage": 0},
+        {"stage": 1},
+        {"stage": 2},
+        {"stage": 0, "reset": True},
+    ]
+
+
+def test_bucket_percentile_returns_bucket_upper_bound():
+    """Test that a percentile lands on the top of the log2 bucket that holds it"""
+    buckets = [0] * 32
+    buckets[4] = 90  # 16 to 31 cycles
+    buckets[10] = 10  # 1024 to 2047 cycles
+
+    assert bucket_percentile(buckets, 0.5) == 31
+    assert bucket_percentile(buckets, 0.99) == 2047
+    assert bucket_percentile([0] * 32, 0.5) == 0
+
+
+def test_read_stats_reads_every_method_page():
+    """Test that method call counts are paged through until every method the device reports has been read"""
+
+    def handler(request):
+        if "first" not in request["params"]:
+            return {"status": "success", "message": "Stats read", "rx_bytes": 100, "methods": 3}
+        first = request["params"]["first"]
+        calls = [["test", False, 4], ["clear_display", False, 0], ["display_image", True, 1]][first : first + 2]
+        return {"status": "success", "message": "Method counts read", "methods": 3, "next": first + 2, "calls": calls}
+
+    device = FakeDevice(handler)
+
+    counters, calls = read_stats(device)
+
+    assert counters["rx_bytes"] == 100
+    assert calls == [("test", False, 4), ("clear_display", False, 0), ("display_image", True, 1)]
+    assert [request["params"] for request in device.requests] == [{}, {"first": 0}, {"first": 2}]
+
+
+def test_check_idle_resync_reports_dropped_message():
+    """Test that an abandoned message is followed by an idle gap and then a request the device answers"""
+    resyncs = [0]
+    received = bytearray()
+
+    def sleep(seconds):
+        # The device drops the unfinished message once the line has been idle long enough
+        assert seconds * 1000 >= RESYNC_IDLE_MS
+        received.clear()
+        resyncs[0] += 1
+
+    device = FakeDevice(lambda request: {"status": "success", "message": "Stats read", "resyncs": resyncs[0]})
+
+    def write(data, original=device.write):
+        received.extend(data)
+        length = struct.unpack(">I", received[:4])[0]
+        if len(received) >= 4 + length:
+            original(bytes(received))
+            received.clear()
+
+    device.write = write
+
+    response = check_idle_resync(device, sleep=sleep)
+
+    assert response["resynced"] == 1
+    assert [request["method"] for request in device.requests] == ["get_stats", "get_stats"]